@@ -1,6 +1,9 @@
 #include "../network/network_manager.h"
+#include "../network/packet_schema.h"
+#include "../network/packet_dispatcher.h"
 #include "../common/log_manager.h"
 #include "../common/config_manager.h"
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <chrono>
@@ -36,6 +39,23 @@ public:
         Common::LogManager::Instance().SetLogLevel(StringToLogLevel(log_level_));
         Common::LogManager::Instance().SetConsoleOutput(Common::AuthServerConfig::GetConsoleOutput());
         Common::LogManager::Instance().SetFileOutput(Common::AuthServerConfig::GetFileOutput(), log_file_);
+        Common::LogManager::Instance().SetAsyncMode(
+            Common::AuthServerConfig::GetLogAsync(),
+            static_cast<size_t>(std::max(4, Common::AuthServerConfig::GetLogBufferKb())) * 1024,
+            Common::ParseLogOverflowPolicy(Common::AuthServerConfig::GetLogOverflowPolicy()),
+            std::chrono::milliseconds(Common::AuthServerConfig::GetLogFlushIntervalMs()));
+        Common::LogRotationPolicy rotation;
+        rotation.max_file_bytes =
+            static_cast<uint64_t>(std::max(0, Common::AuthServerConfig::GetLogRotateSizeMb())) << 20;
+        rotation.interval = std::chrono::minutes(std::max(0, Common::AuthServerConfig::GetLogRotateIntervalMin()));
+        rotation.max_files = static_cast<size_t>(std::max(0, Common::AuthServerConfig::GetLogRetainFiles()));
+        rotation.max_total_bytes =
+            static_cast<uint64_t>(std::max(0, Common::AuthServerConfig::GetLogRetainTotalMb())) << 20;
+        rotation.compress = Common::AuthServerConfig::GetLogCompress();
+        Common::LogManager::Instance().SetRotation(rotation);
+        if (Common::AuthServerConfig::GetLogBinary()) {
+            Common::LogManager::Instance().SetBinaryOutput(true, Common::AuthServerConfig::GetLogBinaryFile());
+        }
 
         LOG_INFO("AUTH", "Initializing Authentication Server...");
         LOG_INFO_FORMAT("AUTH", "Port: %d, Max Connections: %d, Log Level: %s",
@@ -46,11 +66,13 @@ public:
                        Common::AuthServerConfig::GetDatabaseHost().c_str(),
                        Common::AuthServerConfig::GetDatabasePort());
 
-        if (!network_manager_.InitializeServer(port_, max_connections_)) {
+        if (!network_manager_.InitializeServer(port_, max_connections_,
+                                              Common::AuthServerConfig::GetIoThreads())) {
             LOG_ERROR_FORMAT("AUTH", "Failed to initialize Auth Server on port %d", port_);
             return false;
         }
 
+        RegisterHandlers();
         SetupCallbacks();
         LOG_INFO("AUTH", "Authentication Server initialized successfully");
         return true;
@@ -81,10 +103,21 @@ private:
         });
 
         network_manager_.SetOnPacketReceived([this](std::shared_ptr<Network::Connection> conn, const Network::Packet& packet) {
-            HandlePacket(conn, packet);
+            dispatcher_.Dispatch(conn, packet);
         });
     }
 
+    void RegisterHandlers() {
+        dispatcher_.Register<Network::EchoMessage>(
+            [this](const Network::PacketDispatcher::ConnectionPtr& conn, const Network::EchoMessage&) {
+                network_manager_.SendToClient(conn, Network::EncodePacket(Network::EchoMessage{"AUTH_ECHO_RESPONSE"}));
+            });
+        dispatcher_.Register<Network::AuthRequest>(
+            [this](const Network::PacketDispatcher::ConnectionPtr& conn, const Network::AuthRequest& request) {
+                HandleAuthRequest(conn, request);
+            });
+    }
+
     void ProcessCommands() {
         std::string input;
         while (std::getline(std::cin, input)) {
@@ -105,32 +138,13 @@ private:
         }
     }
 
-    void HandlePacket(std::shared_ptr<Network::Connection> conn, const Network::Packet& packet) {
-        LOG_DEBUG_FORMAT("AUTH", "Received packet type %d from %s",
-                        packet.type, conn->GetAddress().c_str());
-
-        switch (packet.type) {
-            case Network::PACKET_ECHO: {
-                std::string message = "AUTH_ECHO_RESPONSE";
-                auto response_data = Network::SerializeString(message);
-                Network::Packet response(Network::PACKET_ECHO, response_data);
-                network_manager_.SendToClient(conn, response);
-                break;
-            }
-            case Network::PACKET_AUTH_REQUEST: {
-                // 실제 인증 로직
-                std::string auth_response = "AUTH_SUCCESS";
-                auto response_data = Network::SerializeString(auth_response);
-                Network::Packet response(Network::PACKET_AUTH_RESPONSE, response_data);
-                network_manager_.SendToClient(conn, response);
-                LOG_INFO_FORMAT("AUTH", "Authentication processed for %s", conn->GetAddress().c_str());
-                break;
-            }
-            default:
-                LOG_WARNING_FORMAT("AUTH", "Unknown packet type %d from %s",
-                                 packet.type, conn->GetAddress().c_str());
-                break;
-        }
+    void HandleAuthRequest(const std::shared_ptr<Network::Connection>& conn, const Network::AuthRequest& request) {
+        // 실제 인증 로직
+        Network::Packet response = Network::EncodePacket(Network::AuthResponse{"AUTH_SUCCESS"});
+        network_manager_.SendToClient(conn, response);
+        LOG_INFO_FORMAT("AUTH", "Authentication processed for %s (user: %.*s)",
+                       conn->GetAddress().c_str(),
+                       static_cast<int>(request.username.size()), request.username.data());
     }
 
     void PrintStatus() {
@@ -141,6 +155,21 @@ private:
         LOG_INFO_FORMAT("AUTH", "Current Connections: %d", connection_count);
         LOG_INFO_FORMAT("AUTH", "Log Level: %s", log_level_.c_str());
         LOG_INFO_FORMAT("AUTH", "Server Running: %s", network_manager_.IsServerRunning() ? "Yes" : "No");
+        PrintPacketStats();
+    }
+
+    void PrintPacketStats() {
+        for (const auto& stats : dispatcher_.GetStats()) {
+            LOG_INFO_FORMAT("AUTH", "Packet %s", stats.Describe().c_str());
+        }
+        LOG_INFO_FORMAT("AUTH", "Unknown packets dropped: %llu (last type %u)",
+                       static_cast<unsigned long long>(dispatcher_.GetUnknownCount()),
+                       dispatcher_.GetLastUnknownType());
+        LOG_INFO_FORMAT("AUTH", "Log mode: %s%s, dropped: %llu, rotations: %llu",
+                       Common::LogManager::Instance().IsAsync() ? "async" : "sync",
+                       Common::LogManager::Instance().IsBinary() ? " binary" : "",
+                       static_cast<unsigned long long>(Common::LogManager::Instance().GetDroppedCount()),
+                       static_cast<unsigned long long>(Common::LogManager::Instance().GetRotationCount()));
     }
 
     void PrintConfig() {
@@ -183,6 +212,7 @@ private:
     }
 
     Network::NetworkManager network_manager_;
+    Network::PacketDispatcher dispatcher_;
     int port_;
     int max_connections_;
     std::string log_level_;
@@ -0,0 +1,117 @@
+// benchmarks/broadphase_benchmark.cpp
+// 엔티티 간 충돌 브로드페이즈 벤치마크
+// 엔티티를 맵에 흩어 놓고 매 틱 조금씩 움직이며 sweep-and-prune 후보 쌍 찾기 + 밀어내기 시간을 잰다.
+// 틱 사이 정렬 순서를 유지하는 효과를 보려고 매 틱 새로 정렬하는 경우도 함께 재고,
+// 작은 규모에서는 전수 비교와 쌍 수가 같은지 확인한다.
+#include "../common/broadphase.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr int kWarmupTicks = 20;
+constexpr int kMeasureTicks = 300;
+constexpr float kMapSize = 1024.0f;
+constexpr float kRadius = 0.35f;
+constexpr float kDt = 1.0f / 60.0f;
+
+struct World {
+    std::vector<float> positions;
+    std::vector<float> velocities;
+
+    World(size_t count, float area)
+        : positions(count * 2), velocities(count * 2) {
+        for (size_t i = 0; i < count; ++i) {
+            positions[2 * i] = 1.0f + std::fmod(static_cast<float>(i) * 37.77f, area);
+            positions[2 * i + 1] = 1.0f + std::fmod(static_cast<float>(i) * 91.13f, area);
+            float angle = static_cast<float>(i) * 0.61803f;
+            velocities[2 * i] = std::cos(angle) * 3.0f;
+            velocities[2 * i + 1] = std::sin(angle) * 3.0f;
+        }
+    }
+
+    void Step() {
+        for (size_t i = 0; i < positions.size(); ++i) {
+            positions[i] = std::min(std::max(positions[i] + velocities[i] * kDt, 1.0f), kMapSize - 2.0f);
+        }
+    }
+};
+
+size_t BruteForcePairs(const std::vector<float>& positions) {
+    size_t count = positions.size() / 2;
+    float reach_sq = 4.0f * kRadius * kRadius;
+    size_t pairs = 0;
+    for (size_t a = 0; a < count; ++a) {
+        for (size_t b = a + 1; b < count; ++b) {
+            float dx = positions[2 * b] - positions[2 * a];
+            float dy = positions[2 * b + 1] - positions[2 * a + 1];
+            pairs += dx * dx + dy * dy <= reach_sq ? 1 : 0;
+        }
+    }
+    return pairs;
+}
+
+struct Result {
+    double avg_us;
+    double max_us;
+    double avg_pairs;
+    bool matches;
+};
+
+Result Run(size_t count, float area, bool keep_order) {
+    World world(count, area);
+    Common::SweepAndPrune broadphase;
+    Result result{0.0, 0.0, 0.0, true};
+
+    for (int tick = 0; tick < kWarmupTicks + kMeasureTicks; ++tick) {
+        world.Step();
+        if (!keep_order) {
+            broadphase = Common::SweepAndPrune();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        const auto& pairs = broadphase.FindPairs(world.positions.data(), count, kRadius);
+        size_t pair_count = pairs.size();
+        if (count <= 2000 && tick == kWarmupTicks) {
+            result.matches = pair_count == BruteForcePairs(world.positions);
+        }
+        Common::ResolveOverlaps(world.positions.data(), pairs, kRadius, nullptr);
+        double elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        if (tick >= kWarmupTicks) {
+            result.avg_us += elapsed;
+            result.max_us = std::max(result.max_us, elapsed);
+            result.avg_pairs += static_cast<double>(pair_count);
+        }
+    }
+    result.avg_us /= kMeasureTicks;
+    result.avg_pairs /= kMeasureTicks;
+    return result;
+}
+
+} // anonymous namespace
+
+int main() {
+    const size_t entity_counts[] = { 1000, 10000, 100000 };
+
+    std::printf("%-10s %-8s %-10s %10s %10s %12s %10s\n",
+                "entities", "density", "order", "avg_us", "max_us", "ns/entity", "pairs");
+    for (size_t entities : entity_counts) {
+        // sparse: 맵 전체, dense: 엔티티당 약 1타일
+        for (bool dense : { false, true }) {
+            float area = dense ? std::sqrt(static_cast<float>(entities)) : kMapSize - 3.0f;
+            for (bool keep_order : { true, false }) {
+                Result result = Run(entities, area, keep_order);
+                std::printf("%-10zu %-8s %-10s %10.2f %10.2f %12.3f %10.1f%s\n", entities,
+                            dense ? "dense" : "sparse", keep_order ? "coherent" : "resort",
+                            result.avg_us, result.max_us, result.avg_us * 1000.0 / entities, result.avg_pairs,
+                            result.matches ? "" : "  (MISMATCH)");
+            }
+        }
+    }
+    return 0;
+}
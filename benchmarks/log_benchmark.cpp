@@ -0,0 +1,157 @@
+// benchmarks/log_benchmark.cpp
+// 로그 호출 경로 벤치마크
+// 여러 스레드가 동시에 LOG_INFO_FORMAT을 호출할 때 호출 한 번의 지연(평균/p99/최대)과 전체 처리량을
+// 동기 모드(전역 락 + 줄마다 flush)와 비동기 모드(스레드별 링 버퍼, drop/block 정책), 바이너리 모드
+// (호출 스레드는 포맷하지 않고 인자 바이트만 넣는다)에서 잰다.
+// 콘솔 출력은 끄고 임시 디렉토리의 파일에만 쓴다. 꺼진 레벨(DEBUG) 호출이 인자를 평가하지 않는지와
+// 시각 함수(캐시된 시각 문자열, NowNanos, steady_clock) 비용도 잰다.
+#include "../common/log_manager.h"
+#include "../common/coarse_clock.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kMessagesPerThread = 100000;
+
+struct Result {
+    double calls_per_sec;
+    double avg_ns;
+    double p99_ns;
+    double max_ns;
+    uint64_t dropped;
+};
+
+Result Run(int thread_count, bool async, Common::LogOverflowPolicy policy, bool binary,
+           const std::filesystem::path& binary_file) {
+    Common::LogManager& log = Common::LogManager::Instance();
+    log.SetAsyncMode(async, Common::kDefaultLogBufferSize, policy, std::chrono::milliseconds(100));
+    log.SetBinaryOutput(binary, binary_file.string());
+    uint64_t dropped_before = log.GetDroppedCount();
+
+    std::vector<std::vector<int64_t>> samples(thread_count);
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([t, &samples] {
+            std::vector<int64_t>& local = samples[t];
+            local.reserve(kMessagesPerThread);
+            for (int i = 0; i < kMessagesPerThread; ++i) {
+                auto call_start = std::chrono::steady_clock::now();
+                LOG_INFO_FORMAT("BENCH", "thread %d packet %d from 127.0.0.1:%d size %zu", t, i, 40000 + t,
+                                static_cast<size_t>(i % 512));
+                local.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - call_start).count());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    log.Flush();
+
+    std::vector<int64_t> all;
+    for (const auto& local : samples) {
+        all.insert(all.end(), local.begin(), local.end());
+    }
+    std::sort(all.begin(), all.end());
+    double total = 0.0;
+    for (int64_t sample : all) {
+        total += static_cast<double>(sample);
+    }
+
+    Result result{};
+    result.calls_per_sec = all.size() / elapsed;
+    result.avg_ns = total / all.size();
+    result.p99_ns = static_cast<double>(all[all.size() * 99 / 100]);
+    result.max_ns = static_cast<double>(all.back());
+    result.dropped = log.GetDroppedCount() - dropped_before;
+    return result;
+}
+
+// 꺼진 레벨 호출 - 인자로 문자열을 만드는 비용이 사라졌는지 확인
+double MeasureDisabledCall() {
+    Common::LogManager::Instance().SetLogLevel(Common::LogLevel::INFO);
+    std::string address = "127.0.0.1:40000";
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kMessagesPerThread * 10; ++i) {
+        LOG_DEBUG_FORMAT("BENCH", "packet %d from %s", i, (address + std::to_string(i)).c_str());
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+           (kMessagesPerThread * 10);
+}
+
+// 시각 함수 한 번 호출 비용 (ns)
+template<typename Func>
+double MeasureClock(Func&& func) {
+    constexpr int kCalls = 1000000;
+    int64_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kCalls; ++i) {
+        sink += func();
+    }
+    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    if (sink == 42) {
+        std::printf(" ");  // 최적화로 호출이 사라지지 않도록
+    }
+    return elapsed / kCalls;
+}
+
+} // anonymous namespace
+
+int main() {
+    std::filesystem::path log_file = std::filesystem::temp_directory_path() / "log_benchmark.log";
+    std::filesystem::path binary_file = std::filesystem::temp_directory_path() / "log_benchmark.blog";
+    Common::LogManager& log = Common::LogManager::Instance();
+    log.SetLogLevel(Common::LogLevel::INFO);
+    log.SetConsoleOutput(false);
+    log.SetFileOutput(true, log_file.string());
+
+    struct Mode {
+        const char* name;
+        bool async;
+        Common::LogOverflowPolicy policy;
+        bool binary;
+    };
+    const Mode modes[] = {
+        { "sync", false, Common::LogOverflowPolicy::DROP, false },
+        { "async-drop", true, Common::LogOverflowPolicy::DROP, false },
+        { "async-block", true, Common::LogOverflowPolicy::BLOCK, false },
+        { "binary-drop", true, Common::LogOverflowPolicy::DROP, true },
+    };
+    const int thread_counts[] = { 1, 4, 8 };
+
+    std::printf("disabled DEBUG call: %.2f ns\n", MeasureDisabledCall());
+    std::printf("wall clock text: %.2f ns, NowNanos: %.2f ns, steady_clock::now: %.2f ns\n",
+                MeasureClock([] {
+                    char text[Common::kWallClockTextSize];
+                    Common::GetWallClockText(text);
+                    return static_cast<int64_t>(text[22]);
+                }),
+                MeasureClock([] { return Common::NowNanos(); }),
+                MeasureClock([] { return std::chrono::steady_clock::now().time_since_epoch().count(); }));
+    std::printf("%-8s %-12s %14s %10s %10s %12s %10s\n",
+                "threads", "mode", "calls/s", "avg_ns", "p99_ns", "max_ns", "dropped");
+    for (int threads : thread_counts) {
+        for (const Mode& mode : modes) {
+            Result result = Run(threads, mode.async, mode.policy, mode.binary, binary_file);
+            std::printf("%-8d %-12s %14.0f %10.0f %10.0f %12.0f %10llu\n", threads, mode.name,
+                        result.calls_per_sec, result.avg_ns, result.p99_ns, result.max_ns,
+                        static_cast<unsigned long long>(result.dropped));
+        }
+    }
+
+    log.SetBinaryOutput(false);
+    log.SetAsyncMode(false);
+    log.SetFileOutput(false);
+    std::filesystem::remove(log_file);
+    std::filesystem::remove(binary_file);
+    return 0;
+}
@@ -0,0 +1,119 @@
+// benchmarks/movement_kernel_benchmark.cpp
+// 이동 커널 벤치마크
+// 통로와 기둥이 섞인 맵 위에서 엔티티 수별로 적분 + 경계 클램프 + 통행 검사 한 번의 시간을
+// 이 CPU가 지원하는 구현(scalar, sse2, avx2)마다 측정하고, 결과가 스칼라 구현과 같은지 확인한다.
+// 통행 검사는 타일 비트셋 조회라 스칼라로 남으므로, 검사 없이 적분 + 클램프만 한 경우도 따로 잰다.
+#include "../common/movement_kernel.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr int kWarmupTicks = 20;
+constexpr int kMeasureTicks = 500;
+constexpr int32_t kMapSize = 1024;
+constexpr float kDt = 1.0f / 60.0f;
+
+struct World {
+    std::vector<float> positions;   // (x, y) 쌍
+    std::vector<float> velocities;
+    Common::CollisionMap collision;
+
+    explicit World(size_t count)
+        : positions(count * 2), velocities(count * 2) {
+        // 16칸마다 기둥 - 일부 엔티티가 막히도록
+        collision.Create(kMapSize, kMapSize);
+        for (int32_t y = 0; y < kMapSize; y += 16) {
+            for (int32_t x = 0; x < kMapSize; x += 16) {
+                collision.SetWalkable(x, y, false);
+            }
+        }
+        for (size_t i = 0; i < count; ++i) {
+            positions[2 * i] = static_cast<float>((i * 37) % (kMapSize - 2) + 1) + 0.5f;
+            positions[2 * i + 1] = static_cast<float>((i * 91) % (kMapSize - 2) + 1) + 0.5f;
+            float angle = static_cast<float>(i) * 0.61803f;
+            velocities[2 * i] = std::cos(angle) * 5.0f;
+            velocities[2 * i + 1] = std::sin(angle) * 5.0f;
+        }
+    }
+
+    Common::MovementBatch Batch(bool check_walkable) {
+        Common::MovementBatch batch{};
+        batch.positions = positions.data();
+        batch.velocities = velocities.data();
+        batch.count = positions.size() / 2;
+        batch.dt = kDt;
+        batch.min_x = 1.0f;
+        batch.min_y = 1.0f;
+        batch.max_x = static_cast<float>(kMapSize - 2);
+        batch.max_y = static_cast<float>(kMapSize - 2);
+        batch.collision = check_walkable ? &collision : nullptr;
+        return batch;
+    }
+};
+
+struct Result {
+    double avg_us;
+    double max_us;
+    std::vector<float> positions;
+};
+
+Result Run(size_t entity_count, Common::MovementKernel kernel, bool check_walkable) {
+    World world(entity_count);
+    Common::MovementBatch batch = world.Batch(check_walkable);
+
+    for (int i = 0; i < kWarmupTicks; ++i) {
+        Common::IntegrateMovement(batch, kernel);
+    }
+
+    double total_us = 0.0;
+    double max_us = 0.0;
+    for (int i = 0; i < kMeasureTicks; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        Common::IntegrateMovement(batch, kernel);
+        double elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        total_us += elapsed;
+        max_us = std::max(max_us, elapsed);
+    }
+    return { total_us / kMeasureTicks, max_us, std::move(world.positions) };
+}
+
+} // anonymous namespace
+
+int main() {
+    const size_t entity_counts[] = { 1000, 10000, 100000 };
+    const Common::MovementKernel kernels[] = {
+        Common::MovementKernel::SCALAR, Common::MovementKernel::SSE2, Common::MovementKernel::AVX2
+    };
+
+    std::printf("detected kernel: %s\n", Common::MovementKernelName(Common::DetectMovementKernel()));
+    std::printf("%-10s %-10s %-8s %10s %10s %12s %8s\n",
+                "entities", "mode", "kernel", "avg_us", "max_us", "ns/entity", "speedup");
+    for (size_t entities : entity_counts) {
+        for (bool check_walkable : { true, false }) {
+            const char* mode = check_walkable ? "walkable" : "integrate";
+            Result scalar = Run(entities, Common::MovementKernel::SCALAR, check_walkable);
+            for (Common::MovementKernel kernel : kernels) {
+                if (!Common::IsMovementKernelSupported(kernel)) {
+                    continue;
+                }
+                Result result = kernel == Common::MovementKernel::SCALAR ? scalar : Run(entities, kernel, check_walkable);
+
+                // 모든 구현은 같은 연산 순서가 아니므로(FMA) 한 틱 오차 범위 안에서 비교
+                bool matches = true;
+                for (size_t i = 0; i < result.positions.size() && matches; ++i) {
+                    matches = std::fabs(result.positions[i] - scalar.positions[i]) < 0.5f;
+                }
+                std::printf("%-10zu %-10s %-8s %10.2f %10.2f %12.3f %7.2fx%s\n", entities, mode,
+                            Common::MovementKernelName(kernel), result.avg_us, result.max_us,
+                            result.avg_us * 1000.0 / entities, scalar.avg_us / result.avg_us,
+                            matches ? "" : "  (MISMATCH)");
+            }
+        }
+    }
+    return 0;
+}
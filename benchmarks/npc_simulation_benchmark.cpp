@@ -0,0 +1,117 @@
+// benchmarks/npc_simulation_benchmark.cpp
+// NPC 시뮬레이션 벤치마크
+// 기둥이 섞인 1024x1024 맵에 NPC를 채우고 플레이어를 흩어 둔 채 존 틱(경로 예산 + NPC 갱신)을 돌려
+// 틱 시간 분포와 60Hz 틱 예산(16.6ms)을 넘긴 틱 수를 잰다. 플레이어 수를 바꿔 LOD 효과도 본다.
+#include "../zone_server/npc_manager.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace {
+
+constexpr int kWarmupTicks = 120;
+constexpr int kMeasureTicks = 1200;
+constexpr int32_t kMapSize = 1024;
+constexpr float kDt = 1.0f / 60.0f;
+constexpr double kTickBudgetUs = 1000000.0 / 60.0;
+constexpr int kViewDistance = 50;
+const std::chrono::microseconds kPathBudget(500);
+const std::chrono::microseconds kAiBudget(2000);
+
+struct Result {
+    double avg_us;
+    double p99_us;
+    double max_us;
+    int over_budget;
+    NpcManager::Stats npc;
+    Common::PathService::Stats paths;
+};
+
+std::string WriteTemplates(int npc_count) {
+    std::filesystem::path file = std::filesystem::temp_directory_path() / "npc_simulation_benchmark.json";
+    std::ofstream out(file);
+    out << "{\"npcs\": [\n"
+        << "  {\"id\": 1, \"name\": \"wolf\", \"count\": " << npc_count / 2
+        << ", \"speed\": 4.0, \"wander_radius\": 15, \"idle_seconds\": 2.0},\n"
+        << "  {\"id\": 2, \"name\": \"villager\", \"count\": " << npc_count - npc_count / 2
+        << ", \"speed\": 1.5, \"wander_radius\": 6, \"idle_seconds\": 5.0}\n"
+        << "]}\n";
+    return file.string();
+}
+
+Result Run(int npc_count, int player_count) {
+    Common::CollisionMap map;
+    map.Create(kMapSize, kMapSize);
+    for (int32_t y = 0; y < kMapSize; ++y) {
+        for (int32_t x = 0; x < kMapSize; ++x) {
+            if (x == 0 || y == 0 || x == kMapSize - 1 || y == kMapSize - 1 || (x % 16 == 0 && y % 16 == 0)) {
+                map.SetWalkable(x, y, false);
+            }
+        }
+    }
+
+    Common::PathService paths(map, 4096, 65536);
+    NpcManager npcs(map, paths, npc_count, 5, kViewDistance, kAiBudget);
+    std::string template_file = WriteTemplates(npc_count);
+    npcs.LoadTemplates(template_file);
+    std::filesystem::remove(template_file);
+
+    std::vector<Common::PathPoint> players;
+    for (int i = 0; i < player_count; ++i) {
+        players.push_back(Common::PathPoint{ (i * 379) % (kMapSize - 2) + 1, (i * 613) % (kMapSize - 2) + 1 });
+    }
+
+    for (int i = 0; i < kWarmupTicks; ++i) {
+        paths.Update(kPathBudget);
+        npcs.Update(kDt, players);
+    }
+
+    std::vector<double> samples;
+    samples.reserve(kMeasureTicks);
+    for (int i = 0; i < kMeasureTicks; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        paths.Update(kPathBudget);
+        npcs.Update(kDt, players);
+        samples.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    Result result{};
+    for (double sample : samples) {
+        result.avg_us += sample;
+        result.over_budget += sample > kTickBudgetUs ? 1 : 0;
+    }
+    result.avg_us /= samples.size();
+    std::sort(samples.begin(), samples.end());
+    result.p99_us = samples[samples.size() * 99 / 100];
+    result.max_us = samples.back();
+    result.npc = npcs.GetStats();
+    result.paths = paths.GetStats();
+    return result;
+}
+
+} // anonymous namespace
+
+int main() {
+    const int npc_counts[] = { 1000, 10000 };
+    const int player_counts[] = { 0, 50, 500 };
+
+    std::printf("%-6s %-8s %9s %9s %9s %6s %8s %8s %9s %10s %9s %8s\n", "npcs", "players", "avg_us", "p99_us",
+                "max_us", "over", "active", "near", "dormant", "thinks/t", "deferred", "paths");
+    for (int npc_count : npc_counts) {
+        for (int player_count : player_counts) {
+            Result result = Run(npc_count, player_count);
+            std::printf("%-6d %-8d %9.1f %9.1f %9.1f %6d %8zu %8zu %9zu %10.1f %9llu %8llu\n",
+                        npc_count, player_count, result.avg_us, result.p99_us, result.max_us, result.over_budget,
+                        result.npc.by_lod[NpcManager::LOD_ACTIVE], result.npc.by_lod[NpcManager::LOD_NEAR],
+                        result.npc.by_lod[NpcManager::LOD_DORMANT],
+                        static_cast<double>(result.npc.thinks) / (kWarmupTicks + kMeasureTicks),
+                        static_cast<unsigned long long>(result.npc.deferred_ticks),
+                        static_cast<unsigned long long>(result.paths.requests));
+        }
+    }
+    return 0;
+}
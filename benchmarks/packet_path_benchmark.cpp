@@ -0,0 +1,177 @@
+// benchmarks/packet_path_benchmark.cpp
+// 패킷 경로 벤치마크
+// socketpair 위에서 리액터와 같은 순서(읽기 -> 추출 -> 응답 직렬화 -> 큐잉 -> sendmsg)로
+// echo/move/chat 요청을 처리하고, 정상 상태에서 발생한 malloc 횟수와 처리량을 출력한다.
+#include "../network/network_manager.h"
+#include "../network/packet_schema.h"
+#include "../network/packet_dispatcher.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <sys/socket.h>
+
+namespace {
+
+// 전역 operator new를 가로채 프로세스 전체의 힙 할당 횟수를 센다
+std::atomic<uint64_t> g_malloc_calls{0};
+
+constexpr int kWarmupRounds = 1000;
+constexpr int kMeasureRounds = 20000;
+constexpr int kPacketsPerRound = 16;
+
+struct Result {
+    uint64_t malloc_calls;
+    uint64_t pool_heap_allocations;
+    double packets_per_sec;
+};
+
+bool WriteAll(int fd, const uint8_t* data, size_t length) {
+    while (length > 0) {
+        ssize_t written = write(fd, data, length);
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool DrainResponses(int fd, size_t expected_bytes) {
+    static uint8_t sink[64 * 1024];
+    while (expected_bytes > 0) {
+        ssize_t received = read(fd, sink, expected_bytes < sizeof(sink) ? expected_bytes : sizeof(sink));
+        if (received <= 0) {
+            return false;
+        }
+        expected_bytes -= static_cast<size_t>(received);
+    }
+    return true;
+}
+
+// 게임 서버 핸들러와 같은 방식으로 응답을 만든다
+void RegisterHandlers(Network::PacketDispatcher& dispatcher) {
+    using ConnectionPtr = Network::PacketDispatcher::ConnectionPtr;
+
+    dispatcher.Register<Network::EchoMessage>([](const ConnectionPtr& connection, const Network::EchoMessage&) {
+        connection->Send(Network::EncodePacket(Network::EchoMessage{"GAME_ECHO_RESPONSE"}));
+    });
+
+    dispatcher.Register<Network::PlayerMoveRequest>([](const ConnectionPtr& connection, const Network::PlayerMoveRequest& move) {
+        static int32_t x = 0, y = 0;
+        x += move.dx;
+        y += move.dy;
+        connection->Send(Network::EncodePacket(Network::PlayerMoveResult{connection->GetId(), x, y}));
+    });
+
+    dispatcher.Register<Network::ChatMessage>([](const ConnectionPtr& connection, const Network::ChatMessage& chat) {
+        constexpr std::string_view kPrefix = "CHAT_BROADCAST: ";
+        size_t length = kPrefix.size() + chat.message.size();
+        Network::PacketWriter writer(sizeof(uint16_t) + length);
+        writer.WriteUInt16(static_cast<uint16_t>(length));
+        writer.WriteBytes(kPrefix.data(), kPrefix.size());
+        writer.WriteBytes(chat.message.data(), chat.message.size());
+        connection->Send(Network::Packet(Network::PACKET_PLAYER_CHAT, writer.Release()));
+    });
+}
+
+Result RunScenario(const Network::Packet& request) {
+    int sockets[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0) {
+        std::perror("socketpair");
+        std::exit(1);
+    }
+
+    auto connection = std::make_shared<Network::Connection>(sockets[0], "benchmark");
+    connection->SetNonBlocking();
+
+    // 클라이언트 요청 묶음은 미리 인코딩
+    Network::SharedFrame frame = Network::EncodeFrame(request);
+    Network::ByteBuffer batch;
+    for (int i = 0; i < kPacketsPerRound; ++i) {
+        batch.insert(batch.end(), frame->begin(), frame->end());
+    }
+
+    Network::PacketDispatcher dispatcher;
+    RegisterHandlers(dispatcher);
+
+    std::vector<Network::Packet> packets;
+    packets.reserve(kPacketsPerRound);
+    size_t response_bytes = 0;
+
+    auto run_round = [&]() {
+        WriteAll(sockets[1], batch.data(), batch.size());
+        packets.clear();
+        connection->ReadPackets(packets);
+        for (const auto& packet : packets) {
+            dispatcher.Dispatch(connection, packet);
+        }
+        size_t queued = connection->GetQueuedBytes();
+        connection->FlushPendingSends();
+        connection->ClearFlushScheduled();
+        DrainResponses(sockets[1], queued);
+        response_bytes += queued;
+    };
+
+    for (int i = 0; i < kWarmupRounds; ++i) {
+        run_round();
+    }
+
+    Network::BufferPool::ResetStats();
+    uint64_t malloc_before = g_malloc_calls.load();
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < kMeasureRounds; ++i) {
+        run_round();
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    uint64_t malloc_calls = g_malloc_calls.load() - malloc_before;
+
+    connection->Close();
+    close(sockets[1]);
+
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    return { malloc_calls, Network::BufferPool::GetStats().heap_allocations,
+             kMeasureRounds * kPacketsPerRound / seconds };
+}
+
+void PrintResult(const char* name, const Result& result) {
+    double packets = static_cast<double>(kMeasureRounds) * kPacketsPerRound;
+    std::printf("%-6s packets=%.0f malloc=%llu (%.3f/packet) pool_heap=%llu throughput=%.0f pkt/s\n",
+                name, packets,
+                static_cast<unsigned long long>(result.malloc_calls),
+                result.malloc_calls / packets,
+                static_cast<unsigned long long>(result.pool_heap_allocations),
+                result.packets_per_sec);
+}
+
+} // anonymous namespace
+
+void* operator new(size_t size) {
+    g_malloc_calls.fetch_add(1, std::memory_order_relaxed);
+    if (void* block = std::malloc(size == 0 ? 1 : size)) {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept {
+    std::free(block);
+}
+
+void operator delete(void* block, size_t) noexcept {
+    std::free(block);
+}
+
+int main() {
+    PrintResult("echo", RunScenario(Network::EncodePacket(Network::EchoMessage{"ECHO_TEST_MESSAGE"})));
+    PrintResult("move", RunScenario(Network::EncodePacket(Network::PlayerMoveRequest{1, -1})));
+    PrintResult("chat", RunScenario(Network::EncodePacket(
+        Network::ChatMessage{"Hello everyone, this is a chat message"})));
+    return 0;
+}
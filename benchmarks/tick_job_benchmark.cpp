@@ -0,0 +1,135 @@
+// benchmarks/tick_job_benchmark.cpp
+// 틱 병렬 실행 벤치마크
+// 엔티티마다 이동 적분 + 경계 클램프, 간단한 AI(목표 방향 재계산), 동기화 패킷 생성을 수행하는 틱을
+// 엔티티 수와 잡 워커 수를 바꿔가며 실행하고 틱당 평균/최대 시간을 출력한다.
+#include "../common/job_system.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kWarmupTicks = 20;
+constexpr int kMeasureTicks = 200;
+constexpr float kMapSize = 1024.0f;
+constexpr size_t kSyncRecordSize = 12;   // id + x + y
+
+struct World {
+    std::vector<float> x, y, vx, vy, target_x, target_y;
+    std::vector<uint8_t> sync_buffer;
+
+    explicit World(size_t count)
+        : x(count), y(count), vx(count), vy(count), target_x(count), target_y(count)
+        , sync_buffer(count * kSyncRecordSize) {
+        for (size_t i = 0; i < count; ++i) {
+            x[i] = static_cast<float>((i * 37) % 1024);
+            y[i] = static_cast<float>((i * 91) % 1024);
+            target_x[i] = static_cast<float>((i * 53) % 1024);
+            target_y[i] = static_cast<float>((i * 17) % 1024);
+        }
+    }
+
+    size_t Size() const { return x.size(); }
+};
+
+// 한 엔티티 범위의 틱 작업 - 범위끼리는 서로 겹치지 않는다
+void TickRange(World& world, size_t begin, size_t end, float dt) {
+    for (size_t i = begin; i < end; ++i) {
+        // AI: 목표 방향으로 속도 재설정, 도착하면 목표 변경
+        float dx = world.target_x[i] - world.x[i];
+        float dy = world.target_y[i] - world.y[i];
+        float distance = std::sqrt(dx * dx + dy * dy);
+        if (distance < 1.0f) {
+            world.target_x[i] = std::fmod(world.target_x[i] * 1.37f + 97.0f, kMapSize);
+            world.target_y[i] = std::fmod(world.target_y[i] * 1.91f + 13.0f, kMapSize);
+        } else {
+            world.vx[i] = dx / distance * 5.0f;
+            world.vy[i] = dy / distance * 5.0f;
+        }
+
+        // 이동 적분 + 경계 클램프
+        world.x[i] = std::clamp(world.x[i] + world.vx[i] * dt, 0.0f, kMapSize - 1.0f);
+        world.y[i] = std::clamp(world.y[i] + world.vy[i] * dt, 0.0f, kMapSize - 1.0f);
+
+        // 동기화 레코드 작성
+        uint8_t* record = &world.sync_buffer[i * kSyncRecordSize];
+        uint32_t id = static_cast<uint32_t>(i);
+        std::memcpy(record, &id, sizeof(id));
+        std::memcpy(record + 4, &world.x[i], sizeof(float));
+        std::memcpy(record + 8, &world.y[i], sizeof(float));
+    }
+}
+
+struct Result {
+    double avg_ms;
+    double max_ms;
+};
+
+// workers < 0 이면 잡 시스템 없이 호출 스레드에서 직접 실행
+Result Run(size_t entity_count, int workers) {
+    World world(entity_count);
+    std::unique_ptr<Common::JobSystem> jobs;
+    if (workers >= 0) {
+        jobs = std::make_unique<Common::JobSystem>(workers);
+    }
+
+    auto tick = [&]() {
+        if (jobs) {
+            jobs->ParallelFor(world.Size(), 0, [&world](size_t begin, size_t end) {
+                TickRange(world, begin, end, 0.05f);
+            });
+        } else {
+            TickRange(world, 0, world.Size(), 0.05f);
+        }
+    };
+
+    for (int i = 0; i < kWarmupTicks; ++i) {
+        tick();
+    }
+
+    double total_ms = 0.0;
+    double max_ms = 0.0;
+    for (int i = 0; i < kMeasureTicks; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        tick();
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        total_ms += elapsed;
+        max_ms = std::max(max_ms, elapsed);
+    }
+    return { total_ms / kMeasureTicks, max_ms };
+}
+
+} // anonymous namespace
+
+int main() {
+    const size_t entity_counts[] = { 1000, 10000, 100000, 1000000 };
+    int hardware = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    // 워커 수: 직렬, 그리고 1, 2, 4, ... 코어 수 - 1 (호출 스레드 포함 코어 수만큼 실행)
+    std::vector<int> worker_counts = { -1 };
+    for (int workers = 1; workers < hardware; workers *= 2) {
+        worker_counts.push_back(workers);
+    }
+    if (hardware > 1 && worker_counts.back() != hardware - 1) {
+        worker_counts.push_back(hardware - 1);
+    }
+
+    std::printf("%-10s %-8s %10s %10s\n", "entities", "workers", "avg_ms", "max_ms");
+    for (size_t entities : entity_counts) {
+        for (int workers : worker_counts) {
+            Result result = Run(entities, workers);
+            if (workers < 0) {
+                std::printf("%-10zu %-8s %10.3f %10.3f\n", entities, "serial", result.avg_ms, result.max_ms);
+            } else {
+                std::printf("%-10zu %-8d %10.3f %10.3f\n", entities, workers, result.avg_ms, result.max_ms);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,378 @@
+// common/binary_log.cpp
+#include "binary_log.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Common {
+
+namespace {
+
+constexpr uint16_t kNullString = 0xFFFF;   // NULL 포인터 문자열 - printf처럼 "(null)"로 출력
+
+template<typename T>
+bool ReadValue(const uint8_t*& cursor, const uint8_t* end, T& value) {
+    if (static_cast<size_t>(end - cursor) < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, cursor, sizeof(T));
+    cursor += sizeof(T);
+    return true;
+}
+
+bool IsFlag(char c) {
+    return c == '-' || c == '+' || c == ' ' || c == '#' || c == '0';
+}
+
+bool IsLengthModifier(char c) {
+    return c == 'h' || c == 'l' || c == 'L' || c == 'q' || c == 'j' || c == 'z' || c == 't';
+}
+
+} // anonymous namespace
+
+uint64_t ParseBoundedStrings(const char* format) {
+    uint64_t bounded = 0;
+    size_t arg = 0;
+    for (const char* p = format; *p; ++p) {
+        if (*p != '%') {
+            continue;
+        }
+        ++p;
+        if (*p == '%') {
+            continue;
+        }
+        while (IsFlag(*p)) ++p;
+        if (*p == '*') {
+            ++arg;
+            ++p;
+        }
+        while (*p >= '0' && *p <= '9') ++p;
+        bool star_precision = false;
+        if (*p == '.') {
+            ++p;
+            if (*p == '*') {
+                star_precision = true;
+                ++arg;
+                ++p;
+            }
+            while (*p >= '0' && *p <= '9') ++p;
+        }
+        while (IsLengthModifier(*p)) ++p;
+        if (*p == '\0') {
+            break;
+        }
+        if (*p == 's' && star_precision && arg < 64) {
+            bounded |= uint64_t(1) << arg;
+        }
+        ++arg;
+    }
+    return bounded;
+}
+
+void LogArgEncoder::PutUInt(uint64_t value) {
+    std::memcpy(buffer_ + size_, &value, sizeof(value));
+    size_ += sizeof(value);
+}
+
+void LogArgEncoder::PutDouble(double value) {
+    std::memcpy(buffer_ + size_, &value, sizeof(value));
+    size_ += sizeof(value);
+}
+
+void LogArgEncoder::PutString(const char* value) {
+    uint16_t length = kNullString;
+    // 뒤 인자 몫과 길이 필드를 남기고 쓸 수 있는 만큼만
+    size_t available = capacity_ - size_ - remaining_fixed_ - sizeof(uint16_t);
+    available = std::min<size_t>(available, kNullString - 1);
+    if (value) {
+        if (index_ < 64 && (bounded_strings_ >> index_) & 1) {
+            // "%.*s" - 앞 인자가 정한 길이까지만 읽는다 (NUL로 끝나지 않는 버퍼)
+            size_t bound = last_int_ < 0 ? available : std::min<size_t>(static_cast<size_t>(last_int_), available);
+            length = static_cast<uint16_t>(strnlen(value, bound));
+        } else {
+            length = static_cast<uint16_t>(strnlen(value, available));
+        }
+    }
+    std::memcpy(buffer_ + size_, &length, sizeof(length));
+    size_ += sizeof(length);
+    if (length != kNullString) {
+        std::memcpy(buffer_ + size_, value, length);
+        size_ += length;
+    }
+}
+
+std::string FormatLogPayload(const LogSiteInfo& site, const uint8_t* payload, size_t size) {
+    // 인자 없는 호출은 텍스트 경로와 같이 포맷을 그대로 출력한다
+    if (site.arg_types.empty()) {
+        return site.format;
+    }
+
+    const uint8_t* cursor = payload;
+    const uint8_t* end = payload + size;
+    size_t arg = 0;
+
+    // 다음 인자를 꺼낸다 - 정수는 int64, 실수는 double, 문자열은 str/len
+    struct Value {
+        uint8_t type = LOG_ARG_INT;
+        uint64_t bits = 0;
+        double real = 0.0;
+        std::string text;
+        bool null_text = false;
+    };
+    auto next = [&](Value& value) -> bool {
+        if (arg >= site.arg_types.size()) {
+            return false;
+        }
+        value.type = site.arg_types[arg++];
+        if (value.type == LOG_ARG_STRING) {
+            uint16_t length = 0;
+            if (!ReadValue(cursor, end, length)) return false;
+            value.null_text = length == kNullString;
+            if (value.null_text) {
+                value.text.clear();
+                return true;
+            }
+            if (static_cast<size_t>(end - cursor) < length) return false;
+            value.text.assign(reinterpret_cast<const char*>(cursor), length);
+            cursor += length;
+            return true;
+        }
+        if (value.type == LOG_ARG_DOUBLE) {
+            return ReadValue(cursor, end, value.real);
+        }
+        return ReadValue(cursor, end, value.bits);
+    };
+
+    std::string result;
+    result.reserve(site.format.size() + size);
+    char buffer[512];
+    const char* p = site.format.c_str();
+    while (*p) {
+        if (*p != '%') {
+            result += *p++;
+            continue;
+        }
+        if (p[1] == '%') {
+            result += '%';
+            p += 2;
+            continue;
+        }
+
+        // 변환 지정자 하나를 플래그/폭/정밀도까지 옮기고 길이 수식자는 인코딩 타입에 맞게 바꾼다
+        std::string spec = "%";
+        const char* start = p++;
+        while (IsFlag(*p)) spec += *p++;
+        Value value;
+        if (*p == '*') {
+            if (!next(value)) break;
+            spec += std::to_string(static_cast<int>(static_cast<int64_t>(value.bits)));
+            ++p;
+        }
+        while (*p >= '0' && *p <= '9') spec += *p++;
+        if (*p == '.') {
+            spec += *p++;
+            if (*p == '*') {
+                if (!next(value)) break;
+                spec += std::to_string(std::max(0, static_cast<int>(static_cast<int64_t>(value.bits))));
+                ++p;
+            }
+            while (*p >= '0' && *p <= '9') spec += *p++;
+        }
+        while (IsLengthModifier(*p)) ++p;
+        char conversion = *p;
+        if (conversion == '\0') {
+            result.append(start);
+            break;
+        }
+        ++p;
+
+        if (!next(value)) {
+            result += "<?>";
+            continue;
+        }
+
+        int written = -1;
+        switch (conversion) {
+            case 'd': case 'i':
+                if (value.type == LOG_ARG_INT || value.type == LOG_ARG_UINT) {
+                    spec += "ll";
+                    spec += conversion;
+                    written = std::snprintf(buffer, sizeof(buffer), spec.c_str(),
+                                            static_cast<long long>(value.bits));
+                }
+                break;
+            case 'u': case 'o': case 'x': case 'X':
+                if (value.type == LOG_ARG_INT || value.type == LOG_ARG_UINT) {
+                    spec += "ll";
+                    spec += conversion;
+                    written = std::snprintf(buffer, sizeof(buffer), spec.c_str(),
+                                            static_cast<unsigned long long>(value.bits));
+                }
+                break;
+            case 'c':
+                if (value.type == LOG_ARG_INT || value.type == LOG_ARG_UINT) {
+                    spec += conversion;
+                    written = std::snprintf(buffer, sizeof(buffer), spec.c_str(), static_cast<int>(value.bits));
+                }
+                break;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+                if (value.type == LOG_ARG_DOUBLE) {
+                    spec += conversion;
+                    written = std::snprintf(buffer, sizeof(buffer), spec.c_str(), value.real);
+                }
+                break;
+            case 's':
+                if (value.type == LOG_ARG_STRING) {
+                    spec += conversion;
+                    const char* text = value.null_text ? "(null)" : value.text.c_str();
+                    int needed = std::snprintf(nullptr, 0, spec.c_str(), text);
+                    if (needed >= 0) {
+                        std::string formatted(static_cast<size_t>(needed) + 1, '\0');
+                        std::snprintf(&formatted[0], formatted.size(), spec.c_str(), text);
+                        formatted.pop_back();
+                        result += formatted;
+                        continue;
+                    }
+                }
+                break;
+            case 'p':
+                if (value.type == LOG_ARG_POINTER) {
+                    spec += conversion;
+                    written = std::snprintf(buffer, sizeof(buffer), spec.c_str(),
+                                            reinterpret_cast<void*>(static_cast<uintptr_t>(value.bits)));
+                }
+                break;
+            default:
+                break;
+        }
+
+        if (written < 0) {
+            result += "<?>";
+        } else {
+            result.append(buffer, std::min<size_t>(static_cast<size_t>(written), sizeof(buffer) - 1));
+        }
+    }
+    return result;
+}
+
+BinaryLogReader::~BinaryLogReader() {
+    if (file_) {
+        std::fclose(file_);
+    }
+}
+
+bool BinaryLogReader::Open(const std::string& filename) {
+    file_ = std::fopen(filename.c_str(), "rb");
+    if (!file_) {
+        error_ = "cannot open " + filename;
+        return false;
+    }
+    if (!Read(&header_, sizeof(header_)) || header_.magic != kBinaryLogMagic) {
+        error_ = "not a binary log file";
+        return false;
+    }
+    if (header_.version != kBinaryLogVersion) {
+        error_ = "unsupported binary log version " + std::to_string(header_.version);
+        return false;
+    }
+    return true;
+}
+
+bool BinaryLogReader::Read(void* data, size_t size) {
+    return std::fread(data, 1, size, file_) == size;
+}
+
+bool BinaryLogReader::ReadSite() {
+    uint32_t id = 0;
+    uint8_t level = 0, arg_count = 0;
+    uint16_t category_length = 0, format_length = 0, file_length = 0;
+    uint32_t line = 0;
+    if (!Read(&id, sizeof(id)) || !Read(&level, 1) || !Read(&arg_count, 1) ||
+        !Read(&category_length, sizeof(category_length)) || !Read(&format_length, sizeof(format_length)) ||
+        !Read(&file_length, sizeof(file_length)) || !Read(&line, sizeof(line))) {
+        return false;
+    }
+    // 지점 ID는 1부터 차례로 발급된다 - 건너뛴 ID는 손상된 파일이다 (크기를 그대로 믿으면 거대한 할당이 된다)
+    if (id == 0 || id > sites_.size() + 1) {
+        return false;
+    }
+
+    LogSiteInfo site;
+    site.id = id;
+    site.level = level;
+    site.line = line;
+    site.arg_types.resize(arg_count);
+    site.category.resize(category_length);
+    site.format.resize(format_length);
+    site.file.resize(file_length);
+    if ((arg_count && !Read(site.arg_types.data(), arg_count)) ||
+        (category_length && !Read(&site.category[0], category_length)) ||
+        (format_length && !Read(&site.format[0], format_length)) ||
+        (file_length && !Read(&site.file[0], file_length))) {
+        return false;
+    }
+
+    if (id > sites_.size()) {
+        sites_.push_back(std::move(site));
+    } else {
+        sites_[id - 1] = std::move(site);
+    }
+    return true;
+}
+
+bool BinaryLogReader::Next(Event& event) {
+    error_.clear();
+    while (true) {
+        uint8_t tag = 0;
+        if (!Read(&tag, 1)) {
+            return false;   // 파일 끝
+        }
+
+        if (tag == BINARY_LOG_SITE) {
+            if (!ReadSite()) {
+                error_ = "truncated or corrupt site record";
+                return false;
+            }
+            continue;
+        }
+
+        if (tag == (kBinaryLogMagic & 0xFF)) {
+            // 같은 파일에 이어 쓴 새 세션 - 지점 ID가 다시 1부터 시작한다
+            std::memcpy(&header_, &tag, 1);
+            if (!Read(reinterpret_cast<uint8_t*>(&header_) + 1, sizeof(header_) - 1) ||
+                header_.magic != kBinaryLogMagic || header_.version != kBinaryLogVersion) {
+                error_ = "corrupt session header";
+                return false;
+            }
+            sites_.clear();
+            continue;
+        }
+
+        if (tag != BINARY_LOG_EVENT) {
+            error_ = "unknown record type " + std::to_string(tag);
+            return false;
+        }
+
+        uint32_t id = 0;
+        int64_t steady_ns = 0;
+        uint16_t payload_length = 0;
+        if (!Read(&id, sizeof(id)) || !Read(&steady_ns, sizeof(steady_ns)) ||
+            !Read(&payload_length, sizeof(payload_length))) {
+            error_ = "truncated event record";
+            return false;
+        }
+        event.payload.resize(payload_length);
+        if (payload_length && !Read(event.payload.data(), payload_length)) {
+            error_ = "truncated event payload";
+            return false;
+        }
+        if (id == 0 || id > sites_.size() || sites_[id - 1].id == 0) {
+            error_ = "event for unknown site " + std::to_string(id);
+            return false;
+        }
+        event.site = &sites_[id - 1];
+        event.system_ns = header_.system_origin_ns + (steady_ns - header_.steady_origin_ns);
+        return true;
+    }
+}
+
+} // namespace Common
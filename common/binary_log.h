@@ -0,0 +1,172 @@
+// common/binary_log.h
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Common {
+
+// 바이너리 로그
+// 호출 지점(LOG_* 매크로 한 줄)마다 포맷 문자열을 처음 한 번만 등록하고, 기록에는 지점 ID, steady 시각,
+// 인자 원본 바이트만 남긴다. snprintf는 기록 스레드(콘솔 출력 시)나 오프라인 디코더(LogDecoder)에서만 한다.
+//
+// 파일 형식 (리틀 엔디언)
+//   파일 헤더: BinaryLogFileHeader
+//   지점 정의: [u8 BINARY_LOG_SITE][u32 id][u8 level][u8 arg_count][u16 category_len][u16 format_len]
+//             [u16 file_len][u32 line][arg_count x u8 타입][category][format][file]
+//   이벤트:   [u8 BINARY_LOG_EVENT][u32 id][i64 steady_ns][u16 payload_len][payload]
+// 지점 정의는 그 지점의 첫 이벤트보다 앞에 쓴다.
+// 인자 인코딩: 정수/포인터/실수는 8바이트, 문자열은 [u16 길이][바이트] (NUL 없음)
+
+constexpr uint32_t kBinaryLogMagic = 0x474F4C4D;   // "MLOG"
+constexpr uint32_t kBinaryLogVersion = 1;
+constexpr size_t kMaxLogArgs = 32;
+constexpr size_t kMaxLogPayload = 1024;
+
+struct BinaryLogFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    int64_t steady_origin_ns;   // 파일을 연 시각 (steady)
+    int64_t system_origin_ns;   // 같은 순간의 벽시계 - 이벤트 시각 = system_origin + (steady - steady_origin)
+};
+
+static_assert(sizeof(BinaryLogFileHeader) == 24, "BinaryLogFileHeader layout");
+
+enum BinaryLogRecordType : uint8_t {
+    BINARY_LOG_SITE = 1,
+    BINARY_LOG_EVENT = 2
+};
+
+enum LogArgType : uint8_t {
+    LOG_ARG_INT,
+    LOG_ARG_UINT,
+    LOG_ARG_DOUBLE,
+    LOG_ARG_STRING,
+    LOG_ARG_POINTER
+};
+
+template<typename T>
+struct LogArgTypeUnsupported : std::false_type {};
+
+template<typename T>
+constexpr uint8_t LogArgTypeOf() {
+    using D = std::decay_t<T>;
+    if constexpr (std::is_same_v<D, char*> || std::is_same_v<D, const char*>) {
+        return LOG_ARG_STRING;
+    } else if constexpr (std::is_floating_point_v<D>) {
+        return LOG_ARG_DOUBLE;
+    } else if constexpr (std::is_pointer_v<D> || std::is_null_pointer_v<D>) {
+        return LOG_ARG_POINTER;
+    } else if constexpr (std::is_enum_v<D>) {
+        return std::is_signed_v<std::underlying_type_t<D>> ? LOG_ARG_INT : LOG_ARG_UINT;
+    } else if constexpr (std::is_integral_v<D>) {
+        return std::is_signed_v<D> ? LOG_ARG_INT : LOG_ARG_UINT;
+    } else {
+        static_assert(LogArgTypeUnsupported<D>::value, "unsupported log argument type");
+        return LOG_ARG_INT;
+    }
+}
+
+// 호출 지점 - 매크로 안의 정적 변수 (상수 초기화라 초기화 가드가 없다)
+struct LogSite {
+    std::atomic<uint32_t> id{0};        // 0이면 아직 등록 전
+    uint64_t bounded_strings = 0;       // "%.*s"처럼 앞 인자가 길이를 정하는 문자열 인자 비트 (id 발행 전에 기록)
+};
+
+// 등록된 지점 정보 - 기록 스레드와 디코더가 쓴다
+struct LogSiteInfo {
+    uint32_t id = 0;
+    uint8_t level = 0;
+    std::string category;
+    std::string format;
+    std::string file;
+    uint32_t line = 0;
+    std::vector<uint8_t> arg_types;
+};
+
+// 포맷에서 앞 인자(정밀도 *)로 길이가 정해지는 문자열 인자의 위치 비트
+uint64_t ParseBoundedStrings(const char* format);
+
+// 인자를 payload로 인코딩 - 문자열은 남은 공간에 맞춰 자른다
+class LogArgEncoder {
+public:
+    LogArgEncoder(uint8_t* buffer, size_t capacity, size_t arg_count, uint64_t bounded_strings)
+        : buffer_(buffer)
+        , capacity_(capacity)
+        , size_(0)
+        , index_(0)
+        , remaining_fixed_(arg_count * sizeof(uint64_t))
+        , last_int_(-1)
+        , bounded_strings_(bounded_strings) {
+    }
+
+    template<typename T>
+    void Add(T value) {
+        constexpr uint8_t type = LogArgTypeOf<T>();
+        remaining_fixed_ -= sizeof(uint64_t);
+        if constexpr (type == LOG_ARG_STRING) {
+            PutString(value);
+        } else if constexpr (type == LOG_ARG_DOUBLE) {
+            PutDouble(static_cast<double>(value));
+        } else if constexpr (type == LOG_ARG_POINTER) {
+            PutUInt(reinterpret_cast<uintptr_t>(static_cast<const void*>(value)));
+        } else if constexpr (type == LOG_ARG_INT) {
+            last_int_ = static_cast<int64_t>(value);
+            PutUInt(static_cast<uint64_t>(static_cast<int64_t>(value)));
+        } else {
+            last_int_ = static_cast<int64_t>(value);
+            PutUInt(static_cast<uint64_t>(value));
+        }
+        ++index_;
+    }
+
+    size_t Size() const { return size_; }
+
+private:
+    void PutUInt(uint64_t value);
+    void PutDouble(double value);
+    void PutString(const char* value);
+
+    uint8_t* buffer_;
+    size_t capacity_;
+    size_t size_;
+    size_t index_;
+    size_t remaining_fixed_;    // 뒤에 남은 인자 몫으로 비워 둘 공간
+    int64_t last_int_;
+    uint64_t bounded_strings_;
+};
+
+// 지점 포맷과 payload로 printf 결과를 다시 만든다 (타입이 맞지 않는 변환은 <?>로)
+std::string FormatLogPayload(const LogSiteInfo& site, const uint8_t* payload, size_t size);
+
+// 바이너리 로그 파일 순차 읽기 (디코더용)
+class BinaryLogReader {
+public:
+    struct Event {
+        const LogSiteInfo* site;
+        int64_t system_ns;          // 벽시계로 환산한 시각
+        std::vector<uint8_t> payload;
+    };
+
+    ~BinaryLogReader();
+
+    bool Open(const std::string& filename);
+    // 다음 이벤트 - 지점 정의는 안에서 처리한다. 끝이거나 손상되면 false (GetError로 구분)
+    bool Next(Event& event);
+    const std::string& GetError() const { return error_; }
+
+private:
+    bool ReadSite();
+    bool Read(void* data, size_t size);
+
+    std::FILE* file_ = nullptr;
+    BinaryLogFileHeader header_{};
+    std::vector<LogSiteInfo> sites_;    // id - 1 위치
+    std::string error_;
+};
+
+} // namespace Common
@@ -0,0 +1,117 @@
+// common/broadphase.cpp
+#include "broadphase.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Common {
+
+void SweepAndPrune::Sort(const float* positions, size_t count) {
+    if (order_.size() != count) {
+        // 엔티티 수가 바뀌면 인덱스 집합이 달라지므로 새로 정렬
+        order_.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            order_[i] = static_cast<uint32_t>(i);
+        }
+    }
+
+    keys_.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        keys_[i] = positions[2 * order_[i]];
+    }
+
+    // 이전 순서 기준 삽입 정렬 - 틱 사이 이동이 작으면 거의 선형
+    size_t shift_budget = count * kMaxShiftsPerEntity;
+    size_t shifts = 0;
+    for (size_t i = 1; i < count && shifts <= shift_budget; ++i) {
+        float key = keys_[i];
+        uint32_t index = order_[i];
+        size_t j = i;
+        while (j > 0 && keys_[j - 1] > key) {
+            keys_[j] = keys_[j - 1];
+            order_[j] = order_[j - 1];
+            --j;
+        }
+        shifts += i - j;
+        keys_[j] = key;
+        order_[j] = index;
+    }
+
+    if (shifts > shift_budget) {
+        std::sort(order_.begin(), order_.end(), [positions](uint32_t a, uint32_t b) {
+            return positions[2 * a] < positions[2 * b];
+        });
+        for (size_t i = 0; i < count; ++i) {
+            keys_[i] = positions[2 * order_[i]];
+        }
+        ++full_sorts_;
+    }
+}
+
+const std::vector<SweepAndPrune::Pair>& SweepAndPrune::FindPairs(const float* positions, size_t count, float radius) {
+    pairs_.clear();
+    Sort(positions, count);
+    ys_.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        ys_[i] = positions[2 * order_[i] + 1];
+    }
+
+    float reach = radius * 2.0f;
+    float reach_sq = reach * reach;
+    for (size_t i = 0; i < count; ++i) {
+        float ax = keys_[i];
+        float ay = ys_[i];
+        for (size_t j = i + 1; j < count && keys_[j] - ax <= reach; ++j) {
+            float dx = keys_[j] - ax;
+            float dy = ys_[j] - ay;
+            if (dx * dx + dy * dy <= reach_sq) {
+                pairs_.push_back(Pair{order_[i], order_[j]});
+            }
+        }
+    }
+    return pairs_;
+}
+
+size_t ResolveOverlaps(float* positions, const std::vector<SweepAndPrune::Pair>& pairs, float radius,
+                       const CollisionMap* map) {
+    float reach = radius * 2.0f;
+    size_t resolved = 0;
+    for (const SweepAndPrune::Pair& pair : pairs) {
+        float* a = positions + 2 * pair.a;
+        float* b = positions + 2 * pair.b;
+        float dx = b[0] - a[0];
+        float dy = b[1] - a[1];
+        float distance = std::sqrt(dx * dx + dy * dy);
+        if (distance >= reach) {
+            continue;   // 앞선 쌍을 밀어내면서 이미 떨어졌다
+        }
+
+        // 완전히 겹쳤으면 인덱스 순서로 방향을 정해 매 틱 같은 쪽으로 민다
+        float nx = 1.0f;
+        float ny = 0.0f;
+        if (distance > 1e-4f) {
+            nx = dx / distance;
+            ny = dy / distance;
+        } else if (pair.a > pair.b) {
+            nx = -1.0f;
+        }
+
+        float push = (reach - distance) * 0.5f;
+        float ax = a[0] - nx * push, ay = a[1] - ny * push;
+        float bx = b[0] + nx * push, by = b[1] + ny * push;
+        bool moved = false;
+        if (!map || map->IsWalkable(static_cast<int32_t>(std::floor(ax)), static_cast<int32_t>(std::floor(ay)))) {
+            a[0] = ax;
+            a[1] = ay;
+            moved = true;
+        }
+        if (!map || map->IsWalkable(static_cast<int32_t>(std::floor(bx)), static_cast<int32_t>(std::floor(by)))) {
+            b[0] = bx;
+            b[1] = by;
+            moved = true;
+        }
+        resolved += moved ? 1 : 0;
+    }
+    return resolved;
+}
+
+} // namespace Common
@@ -0,0 +1,43 @@
+// common/broadphase.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "collision_map.h"
+
+namespace Common {
+
+// 엔티티 간 충돌 브로드페이즈 - x축 sweep-and-prune
+// 모든 엔티티를 같은 반지름의 원으로 보고, x 구간이 겹치는 이웃만 y까지 비교해 후보 쌍을 만든다.
+// 정렬 순서를 틱 사이에 유지해 거의 정렬된 배열을 삽입 정렬로 고친다 (엔티티가 많이 바뀌어
+// 이동 횟수가 한도를 넘으면 전체 정렬로 바꾼다). 스레드 안전하지 않다.
+class SweepAndPrune {
+public:
+    struct Pair {
+        uint32_t a, b;
+    };
+
+    // positions는 (x, y) float 쌍 count개 - 중심 거리가 2 * radius 이하인 쌍을 돌려준다
+    const std::vector<Pair>& FindPairs(const float* positions, size_t count, float radius);
+
+    uint64_t GetFullSorts() const { return full_sorts_; }
+
+private:
+    static constexpr size_t kMaxShiftsPerEntity = 8;
+
+    void Sort(const float* positions, size_t count);
+
+    std::vector<uint32_t> order_;   // x 오름차순 엔티티 인덱스
+    std::vector<float> keys_;       // order_ 순서의 x
+    std::vector<float> ys_;         // order_ 순서의 y - 훑는 동안 위치 배열을 건너뛰며 읽지 않도록
+    std::vector<Pair> pairs_;
+    uint64_t full_sorts_ = 0;
+};
+
+// 겹친 쌍을 중심선 방향으로 반씩 밀어낸다 - map이 있으면 막힌 셀로 밀려나는 쪽은 제자리에 둔다.
+// 실제로 밀어낸 쌍 수를 반환한다.
+size_t ResolveOverlaps(float* positions, const std::vector<SweepAndPrune::Pair>& pairs, float radius,
+                       const CollisionMap* map);
+
+} // namespace Common
@@ -0,0 +1,133 @@
+// common/coarse_clock.cpp
+#include "coarse_clock.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#ifdef __linux__
+    #include <time.h>
+#endif
+
+namespace Common {
+
+namespace {
+
+constexpr size_t kTextWords = kWallClockTextSize / sizeof(uint64_t);
+constexpr size_t kSecondTextLength = 19;    // "YYYY-mm-dd HH:MM:SS"
+
+static_assert(kWallClockTextSize % sizeof(uint64_t) == 0, "wall clock text must fill whole words");
+
+#ifdef __linux__
+int64_t ReadClock(clockid_t clock) {
+    timespec ts;
+    clock_gettime(clock, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+#endif
+
+void FormatSecond(int64_t second, char* text) {
+    std::time_t time = static_cast<std::time_t>(second);
+    std::tm tm;
+#ifdef _WIN32
+    localtime_s(&tm, &time);
+#else
+    localtime_r(&time, &tm);
+#endif
+    std::strftime(text, kSecondTextLength + 1, "%Y-%m-%d %H:%M:%S", &tm);
+}
+
+void AppendMillis(int64_t millis, char* text) {
+    int ms = static_cast<int>(millis % 1000);
+    text[kSecondTextLength] = '.';
+    text[kSecondTextLength + 1] = static_cast<char>('0' + ms / 100);
+    text[kSecondTextLength + 2] = static_cast<char>('0' + ms / 10 % 10);
+    text[kSecondTextLength + 3] = static_cast<char>('0' + ms % 10);
+    text[kSecondTextLength + 4] = '\0';
+}
+
+// 현재 시각 문자열 캐시 - 쓰기는 updating을 잡은 스레드 하나, 읽기는 sequence로 찢어진 값을 걸러낸다
+struct WallClockCache {
+    std::atomic<uint32_t> sequence{0};          // 홀수면 갱신 중
+    std::atomic<int64_t> millis{-1};
+    std::atomic<uint64_t> words[kTextWords] = {};
+    std::atomic<bool> updating{false};
+
+    // updating 보유 스레드 전용
+    int64_t second = -1;
+    char second_text[kWallClockTextSize] = {};
+};
+
+WallClockCache g_wall_clock;
+
+} // anonymous namespace
+
+int64_t NowNanos() {
+#ifdef __linux__
+    return ReadClock(CLOCK_MONOTONIC_COARSE);
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+int64_t WallNanos() {
+#ifdef __linux__
+    return ReadClock(CLOCK_REALTIME_COARSE);
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void FormatWallClock(int64_t wall_ns, char (&text)[kWallClockTextSize]) {
+    int64_t millis = wall_ns / 1000000;
+    FormatSecond(millis / 1000, text);
+    AppendMillis(millis, text);
+}
+
+void GetWallClockText(char (&text)[kWallClockTextSize]) {
+    int64_t millis = WallNanos() / 1000000;
+    WallClockCache& cache = g_wall_clock;
+
+    // 같은 ms면 캐시를 복사
+    uint32_t before = cache.sequence.load(std::memory_order_acquire);
+    if ((before & 1) == 0 && cache.millis.load(std::memory_order_relaxed) == millis) {
+        uint64_t words[kTextWords];
+        for (size_t i = 0; i < kTextWords; ++i) {
+            words[i] = cache.words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (cache.sequence.load(std::memory_order_relaxed) == before) {
+            std::memcpy(text, words, sizeof(words));
+            return;
+        }
+    }
+
+    // ms가 바뀌었다 - 한 스레드만 캐시를 갱신하고, 경합에서 진 스레드는 직접 만든다
+    if (cache.updating.exchange(true, std::memory_order_acquire)) {
+        FormatWallClock(millis * 1000000, text);
+        return;
+    }
+    if (cache.second != millis / 1000) {
+        cache.second = millis / 1000;
+        FormatSecond(cache.second, cache.second_text);
+    }
+    std::memcpy(text, cache.second_text, kSecondTextLength);
+    AppendMillis(millis, text);
+
+    uint64_t words[kTextWords];
+    std::memcpy(words, text, sizeof(words));
+    uint32_t sequence = cache.sequence.load(std::memory_order_relaxed);
+    cache.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    cache.millis.store(millis, std::memory_order_relaxed);
+    for (size_t i = 0; i < kTextWords; ++i) {
+        cache.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    cache.sequence.store(sequence + 2, std::memory_order_release);
+    cache.updating.store(false, std::memory_order_release);
+}
+
+} // namespace Common
@@ -0,0 +1,29 @@
+// common/coarse_clock.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace Common {
+
+// 싼 시각 함수
+// 리눅스에서는 CLOCK_*_COARSE를 읽는다 - vDSO가 커널이 타이머 틱마다 갱신해 둔 값을 복사만 하므로
+// 시스템 콜도 하드웨어 카운터 읽기도 없다. 대신 해상도가 타이머 틱(1~4ms)이다.
+// 로그 시각, 통계 출력 주기처럼 ms 단위면 충분한 곳에 쓰고, 틱 데드라인이나 실행 시간 측정은
+// 지금처럼 steady_clock을 쓴다. 다른 플랫폼은 steady_clock/system_clock으로 대신한다.
+
+// 단조 시각 (ns) - steady_clock과 기준점이 같다 (리눅스 CLOCK_MONOTONIC)
+int64_t NowNanos();
+// 벽시계 (유닉스 시각 ns)
+int64_t WallNanos();
+
+// "YYYY-mm-dd HH:MM:SS.mmm" + NUL
+constexpr size_t kWallClockTextSize = 24;
+
+// wall_ns를 로컬 시각 문자열로
+void FormatWallClock(int64_t wall_ns, char (&text)[kWallClockTextSize]);
+
+// 현재 시각 문자열 - ms가 바뀔 때 한 스레드만 다시 만들고(초 부분은 초가 바뀔 때만),
+// 나머지는 락 없이(seqlock) 복사해 간다
+void GetWallClockText(char (&text)[kWallClockTextSize]);
+
+} // namespace Common
@@ -0,0 +1,332 @@
+// common/collision_map.cpp
+#include "collision_map.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <utility>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Common {
+
+namespace {
+
+constexpr size_t kSectionAlignment = 64;
+constexpr size_t kCellsPerTile = 64;
+
+size_t AlignSection(size_t offset) {
+    return (offset + kSectionAlignment - 1) & ~(kSectionAlignment - 1);
+}
+
+uint32_t Fnv1a(const uint8_t* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// 헤더 값으로부터 각 섹션 위치와 전체 크기 계산
+struct Layout {
+    size_t tile_count;
+    size_t walkable_offset;
+    size_t height_offset;
+    size_t region_offset;
+    size_t total_size;
+};
+
+Layout ComputeLayout(uint32_t tiles_x, uint32_t tiles_y, uint32_t layers) {
+    Layout layout{};
+    layout.tile_count = static_cast<size_t>(tiles_x) * tiles_y;
+    size_t offset = sizeof(CollisionMapHeader);
+    layout.walkable_offset = offset;
+    offset = AlignSection(offset + layout.tile_count * sizeof(uint64_t));
+    if (layers & CollisionMap::LAYER_HEIGHT) {
+        layout.height_offset = offset;
+        offset = AlignSection(offset + layout.tile_count * kCellsPerTile * sizeof(int16_t));
+    }
+    if (layers & CollisionMap::LAYER_REGION) {
+        layout.region_offset = offset;
+        offset = AlignSection(offset + layout.tile_count * kCellsPerTile);
+    }
+    layout.total_size = offset;
+    return layout;
+}
+
+} // anonymous namespace
+
+CollisionMap::CollisionMap()
+    : walkable_(nullptr)
+    , heights_(nullptr)
+    , regions_(nullptr)
+    , width_(0)
+    , height_(0)
+    , tiles_x_(0)
+    , layers_(0)
+    , data_(nullptr)
+    , size_(0)
+    , mapped_(nullptr) {
+}
+
+CollisionMap::~CollisionMap() {
+    Unmap();
+}
+
+CollisionMap::CollisionMap(CollisionMap&& other) noexcept
+    : CollisionMap() {
+    *this = std::move(other);
+}
+
+CollisionMap& CollisionMap::operator=(CollisionMap&& other) noexcept {
+    if (this != &other) {
+        Unmap();
+        walkable_ = std::exchange(other.walkable_, nullptr);
+        heights_ = std::exchange(other.heights_, nullptr);
+        regions_ = std::exchange(other.regions_, nullptr);
+        width_ = std::exchange(other.width_, 0);
+        height_ = std::exchange(other.height_, 0);
+        tiles_x_ = std::exchange(other.tiles_x_, 0);
+        layers_ = std::exchange(other.layers_, 0);
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        mapped_ = std::exchange(other.mapped_, nullptr);
+        owned_ = std::move(other.owned_);   // 벡터 이동은 버퍼 주소를 유지한다
+        other.owned_.clear();
+        error_ = std::move(other.error_);
+    }
+    return *this;
+}
+
+void CollisionMap::Reset() {
+    Unmap();
+    owned_.clear();
+    owned_.shrink_to_fit();
+    walkable_ = nullptr;
+    heights_ = nullptr;
+    regions_ = nullptr;
+    width_ = height_ = 0;
+    tiles_x_ = layers_ = 0;
+    data_ = nullptr;
+    size_ = 0;
+}
+
+void CollisionMap::Unmap() {
+    if (!mapped_) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(mapped_);
+#else
+    munmap(mapped_, size_);
+#endif
+    mapped_ = nullptr;
+}
+
+bool CollisionMap::Load(const std::string& filename, bool validate) {
+    Reset();
+    error_.clear();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        error_ = "cannot open " + filename;
+        return false;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < static_cast<LONGLONG>(sizeof(CollisionMapHeader))) {
+        CloseHandle(file);
+        error_ = "file too small";
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (mapping) {
+        CloseHandle(mapping);   // 뷰가 매핑을 유지한다
+    }
+    CloseHandle(file);
+    if (!view) {
+        error_ = "mmap failed";
+        return false;
+    }
+    size_t size = static_cast<size_t>(file_size.QuadPart);
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error_ = "cannot open " + filename;
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(CollisionMapHeader))) {
+        close(fd);
+        error_ = "file too small";
+        return false;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    void* view = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);  // 매핑은 fd와 무관하게 유지된다
+    if (view == MAP_FAILED) {
+        error_ = "mmap failed";
+        return false;
+    }
+    // 충돌 조회는 위치에 따라 흩어지므로 미리 읽기를 끈다
+    madvise(view, size, MADV_RANDOM);
+#endif
+
+    mapped_ = view;
+    size_ = size;
+    if (!Attach(static_cast<const uint8_t*>(view), size, validate)) {
+        std::string error = error_;
+        Reset();
+        error_ = error;
+        return false;
+    }
+    return true;
+}
+
+bool CollisionMap::Attach(const uint8_t* data, size_t size, bool validate) {
+    CollisionMapHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (header.magic != kCollisionMapMagic) {
+        error_ = "bad magic";
+        return false;
+    }
+    if (header.version != kCollisionMapVersion || header.tile_size != kTileSize) {
+        error_ = "unsupported version or tile size";
+        return false;
+    }
+    if (header.width == 0 || header.height == 0 || header.width > INT32_MAX || header.height > INT32_MAX ||
+        header.tiles_x != (header.width + kTileSize - 1) / kTileSize ||
+        header.tiles_y != (header.height + kTileSize - 1) / kTileSize) {
+        error_ = "bad dimensions";
+        return false;
+    }
+
+    Layout layout = ComputeLayout(header.tiles_x, header.tiles_y, header.layers);
+    if (header.walkable_offset != layout.walkable_offset ||
+        header.height_offset != layout.height_offset ||
+        header.region_offset != layout.region_offset ||
+        size < layout.total_size) {
+        error_ = "section layout does not match header";
+        return false;
+    }
+    if (validate && Fnv1a(data + sizeof(header), layout.total_size - sizeof(header)) != header.checksum) {
+        error_ = "checksum mismatch";
+        return false;
+    }
+
+    data_ = data;
+    width_ = static_cast<int32_t>(header.width);
+    height_ = static_cast<int32_t>(header.height);
+    tiles_x_ = header.tiles_x;
+    layers_ = header.layers;
+    walkable_ = reinterpret_cast<const uint64_t*>(data + layout.walkable_offset);
+    heights_ = layout.height_offset ? reinterpret_cast<const int16_t*>(data + layout.height_offset) : nullptr;
+    regions_ = layout.region_offset ? data + layout.region_offset : nullptr;
+    return true;
+}
+
+void CollisionMap::Create(int32_t width, int32_t height, uint32_t layers) {
+    Reset();
+    error_.clear();
+
+    CollisionMapHeader header{};
+    header.magic = kCollisionMapMagic;
+    header.version = kCollisionMapVersion;
+    header.tile_size = kTileSize;
+    header.width = static_cast<uint32_t>(std::max(1, width));
+    header.height = static_cast<uint32_t>(std::max(1, height));
+    header.tiles_x = (header.width + kTileSize - 1) / kTileSize;
+    header.tiles_y = (header.height + kTileSize - 1) / kTileSize;
+    header.layers = layers & (LAYER_HEIGHT | LAYER_REGION);
+
+    Layout layout = ComputeLayout(header.tiles_x, header.tiles_y, header.layers);
+    header.walkable_offset = layout.walkable_offset;
+    header.height_offset = layout.height_offset;
+    header.region_offset = layout.region_offset;
+
+    owned_.assign(layout.total_size / sizeof(uint64_t), 0);
+    uint8_t* data = reinterpret_cast<uint8_t*>(owned_.data());
+    std::memcpy(data, &header, sizeof(header));
+    size_ = layout.total_size;
+    Attach(data, size_, false);
+
+    for (int32_t y = 0; y < height_; ++y) {
+        for (int32_t x = 0; x < width_; ++x) {
+            SetWalkable(x, y, true);
+        }
+    }
+}
+
+void CollisionMap::SetWalkable(int32_t x, int32_t y, bool walkable) {
+    if (mapped_ || !InBounds(x, y)) {
+        return;
+    }
+    uint64_t& tile = const_cast<uint64_t&>(walkable_[TileIndex(x, y)]);
+    uint64_t bit = uint64_t(1) << CellIndex(x, y);
+    tile = walkable ? (tile | bit) : (tile & ~bit);
+}
+
+void CollisionMap::SetCellHeight(int32_t x, int32_t y, int16_t height) {
+    if (mapped_ || !heights_ || !InBounds(x, y)) {
+        return;
+    }
+    const_cast<int16_t&>(heights_[TileIndex(x, y) * 64 + CellIndex(x, y)]) = height;
+}
+
+void CollisionMap::SetRegion(int32_t x, int32_t y, uint8_t region) {
+    if (mapped_ || !regions_ || !InBounds(x, y)) {
+        return;
+    }
+    const_cast<uint8_t&>(regions_[TileIndex(x, y) * 64 + CellIndex(x, y)]) = region;
+}
+
+bool CollisionMap::Save(const std::string& filename) const {
+    if (!data_) {
+        return false;
+    }
+
+    // 디렉토리가 없으면 생성
+    std::filesystem::path file_path(filename);
+    auto parent_path = file_path.parent_path();
+    if (!parent_path.empty() && !std::filesystem::exists(parent_path)) {
+        try {
+            std::filesystem::create_directories(parent_path);
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    CollisionMapHeader header;
+    std::memcpy(&header, data_, sizeof(header));
+    header.checksum = Fnv1a(data_ + sizeof(header), size_ - sizeof(header));
+
+    std::string temp_name = filename + ".tmp";
+    {
+        std::ofstream file(temp_name, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(data_ + sizeof(header)), size_ - sizeof(header));
+        if (!file.good()) {
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temp_name, filename, error);
+    return !error;
+}
+
+} // namespace Common
@@ -0,0 +1,122 @@
+// common/collision_map.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Common {
+
+// 바이너리 맵 파일 형식 (리틀 엔디안)
+//   [0, 64)          CollisionMapHeader
+//   walkable_offset  타일 비트셋 - 8x8 타일 하나가 uint64 하나, 타일은 행 우선
+//                    비트 번호는 (y % 8) * 8 + (x % 8), 1이면 통행 가능. 맵 밖 패딩 비트는 0
+//   height_offset    (선택) 셀별 int16 높이 - 타일 단위로 64개씩 (타일 내부는 행 우선)
+//   region_offset    (선택) 셀별 uint8 지역 ID - 타일 단위로 64개씩
+// 모든 섹션은 64바이트 경계에서 시작하므로 타일 하나의 통행 비트는 항상 캐시 라인 하나에 있다.
+constexpr uint32_t kCollisionMapMagic = 0x50414D5A;    // "ZMAP"
+constexpr uint16_t kCollisionMapVersion = 1;
+
+struct CollisionMapHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t tile_size;
+    uint32_t width;
+    uint32_t height;
+    uint32_t tiles_x;
+    uint32_t tiles_y;
+    uint32_t layers;            // CollisionMap::Layer 비트
+    uint32_t checksum;          // 헤더 뒤 전체의 FNV-1a
+    uint64_t walkable_offset;
+    uint64_t height_offset;     // 레이어가 없으면 0
+    uint64_t region_offset;
+    uint8_t reserved[8];
+};
+static_assert(sizeof(CollisionMapHeader) == 64, "CollisionMapHeader must stay 64 bytes");
+
+// 충돌 맵
+// Load는 파일을 읽기 전용으로 mmap한다 - 복사 없이 바로 쓰며, 같은 파일을 연 존 프로세스들은
+// 페이지 캐시를 공유한다. Create는 같은 레이아웃을 힙에 만들어 편집 후 Save로 파일을 쓴다.
+// 조회는 스레드 안전하다 (편집은 Create로 만든 맵에서만, 단일 스레드로).
+class CollisionMap {
+public:
+    static constexpr int32_t kTileSize = 8;
+
+    enum Layer : uint32_t {
+        LAYER_HEIGHT = 1 << 0,
+        LAYER_REGION = 1 << 1
+    };
+
+    CollisionMap();
+    ~CollisionMap();
+    CollisionMap(CollisionMap&& other) noexcept;
+    CollisionMap& operator=(CollisionMap&& other) noexcept;
+    CollisionMap(const CollisionMap&) = delete;
+    CollisionMap& operator=(const CollisionMap&) = delete;
+
+    // validate면 체크섬까지 확인 (구조 검사는 항상 한다)
+    bool Load(const std::string& filename, bool validate = true);
+    // 맵 안의 모든 셀을 통행 가능으로 초기화
+    void Create(int32_t width, int32_t height, uint32_t layers = 0);
+    // 임시 파일에 쓴 뒤 교체하므로 이 파일을 mmap 중인 다른 프로세스에 영향이 없다
+    bool Save(const std::string& filename) const;
+    void Reset();
+
+    bool IsLoaded() const { return walkable_ != nullptr; }
+    bool IsMapped() const { return mapped_ != nullptr; }
+    int32_t GetWidth() const { return width_; }
+    int32_t GetHeight() const { return height_; }
+    bool HasLayer(Layer layer) const { return (layers_ & layer) != 0; }
+    size_t GetByteSize() const { return size_; }
+    const std::string& GetError() const { return error_; }
+
+    bool InBounds(int32_t x, int32_t y) const {
+        return static_cast<uint32_t>(x) < static_cast<uint32_t>(width_) &&
+               static_cast<uint32_t>(y) < static_cast<uint32_t>(height_);
+    }
+
+    // 맵 밖은 막힌 것으로 본다
+    bool IsWalkable(int32_t x, int32_t y) const {
+        return InBounds(x, y) && ((walkable_[TileIndex(x, y)] >> CellIndex(x, y)) & 1) != 0;
+    }
+
+    int16_t GetCellHeight(int32_t x, int32_t y) const {
+        return heights_ && InBounds(x, y) ? heights_[TileIndex(x, y) * 64 + CellIndex(x, y)] : 0;
+    }
+
+    uint8_t GetRegion(int32_t x, int32_t y) const {
+        return regions_ && InBounds(x, y) ? regions_[TileIndex(x, y) * 64 + CellIndex(x, y)] : 0;
+    }
+
+    // Create로 만든 맵 전용
+    void SetWalkable(int32_t x, int32_t y, bool walkable);
+    void SetCellHeight(int32_t x, int32_t y, int16_t height);
+    void SetRegion(int32_t x, int32_t y, uint8_t region);
+
+private:
+    size_t TileIndex(int32_t x, int32_t y) const {
+        return static_cast<size_t>(y >> 3) * tiles_x_ + static_cast<size_t>(x >> 3);
+    }
+    static uint32_t CellIndex(int32_t x, int32_t y) {
+        return (static_cast<uint32_t>(y & 7) << 3) | static_cast<uint32_t>(x & 7);
+    }
+
+    bool Attach(const uint8_t* data, size_t size, bool validate);
+    void Unmap();
+
+    const uint64_t* walkable_;
+    const int16_t* heights_;
+    const uint8_t* regions_;
+    int32_t width_;
+    int32_t height_;
+    uint32_t tiles_x_;
+    uint32_t layers_;
+
+    const uint8_t* data_;
+    size_t size_;
+    void* mapped_;                  // mmap한 주소 (nullptr이면 owned_ 사용)
+    std::vector<uint64_t> owned_;   // Create로 만든 파일 이미지 (8바이트 정렬)
+    std::string error_;
+};
+
+} // namespace Common
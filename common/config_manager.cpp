@@ -286,6 +286,17 @@ void AuthServerConfig::LoadDefaults() {
     config.SetString("server", "log_file", "logs/auth_server.log");
     config.SetBool("server", "console_output", true);
     config.SetBool("server", "file_output", true);
+    config.SetBool("server", "log_async", true);
+    config.SetInt("server", "log_buffer_kb", 256);
+    config.SetString("server", "log_overflow_policy", "block");
+    config.SetInt("server", "log_flush_interval_ms", 100);
+    config.SetBool("server", "log_binary", false);
+    config.SetString("server", "log_binary_file", "logs/auth_server.blog");
+    config.SetInt("server", "log_rotate_size_mb", 100);
+    config.SetInt("server", "log_rotate_interval_min", 1440);
+    config.SetInt("server", "log_retain_files", 10);
+    config.SetInt("server", "log_retain_total_mb", 1024);
+    config.SetBool("server", "log_compress", true);
 
     // Database 설정
     config.SetString("database", "host", "localhost");
@@ -300,6 +311,9 @@ void AuthServerConfig::LoadDefaults() {
     config.SetInt("security", "jwt_expiration_hours", 24);
     config.SetInt("security", "password_hash_rounds", 12);
     config.SetBool("security", "ssl_enabled", false);
+
+    // Performance 설정
+    config.SetInt("performance", "io_threads", 2);
 }
 
 int AuthServerConfig::GetPort() {
@@ -326,6 +340,54 @@ bool AuthServerConfig::GetFileOutput() {
     return GetConfig().GetBool("server", "file_output", true);
 }
 
+bool AuthServerConfig::GetLogAsync() {
+    return GetConfig().GetBool("server", "log_async", true);
+}
+
+int AuthServerConfig::GetLogBufferKb() {
+    return GetConfig().GetInt("server", "log_buffer_kb", 256);
+}
+
+std::string AuthServerConfig::GetLogOverflowPolicy() {
+    return GetConfig().GetString("server", "log_overflow_policy", "block");
+}
+
+int AuthServerConfig::GetLogFlushIntervalMs() {
+    return GetConfig().GetInt("server", "log_flush_interval_ms", 100);
+}
+
+bool AuthServerConfig::GetLogBinary() {
+    return GetConfig().GetBool("server", "log_binary", false);
+}
+
+std::string AuthServerConfig::GetLogBinaryFile() {
+    return GetConfig().GetString("server", "log_binary_file", "logs/auth_server.blog");
+}
+
+int AuthServerConfig::GetLogRotateSizeMb() {
+    return GetConfig().GetInt("server", "log_rotate_size_mb", 100);
+}
+
+int AuthServerConfig::GetLogRotateIntervalMin() {
+    return GetConfig().GetInt("server", "log_rotate_interval_min", 1440);
+}
+
+int AuthServerConfig::GetLogRetainFiles() {
+    return GetConfig().GetInt("server", "log_retain_files", 10);
+}
+
+int AuthServerConfig::GetLogRetainTotalMb() {
+    return GetConfig().GetInt("server", "log_retain_total_mb", 1024);
+}
+
+bool AuthServerConfig::GetLogCompress() {
+    return GetConfig().GetBool("server", "log_compress", true);
+}
+
+int AuthServerConfig::GetIoThreads() {
+    return GetConfig().GetInt("performance", "io_threads", 2);
+}
+
 std::string AuthServerConfig::GetDatabaseHost() {
     return GetConfig().GetString("database", "host", "localhost");
 }
@@ -399,6 +461,17 @@ void GatewayServerConfig::LoadDefaults() {
     config.SetString("server", "log_file", "logs/gateway_server.log");
     config.SetBool("server", "console_output", true);
     config.SetBool("server", "file_output", true);
+    config.SetBool("server", "log_async", true);
+    config.SetInt("server", "log_buffer_kb", 256);
+    config.SetString("server", "log_overflow_policy", "block");
+    config.SetInt("server", "log_flush_interval_ms", 100);
+    config.SetBool("server", "log_binary", false);
+    config.SetString("server", "log_binary_file", "logs/gateway_server.blog");
+    config.SetInt("server", "log_rotate_size_mb", 100);
+    config.SetInt("server", "log_rotate_interval_min", 1440);
+    config.SetInt("server", "log_retain_files", 10);
+    config.SetInt("server", "log_retain_total_mb", 1024);
+    config.SetBool("server", "log_compress", true);
 
     // Load Balancing 설정
     config.SetString("load_balance", "method", "round_robin");
@@ -415,6 +488,11 @@ void GatewayServerConfig::LoadDefaults() {
     config.SetBool("rate_limit", "enabled", true);
     config.SetInt("rate_limit", "requests", 100);
     config.SetInt("rate_limit", "window", 60);
+
+    // Performance 설정
+    config.SetInt("performance", "io_threads", 4);
+    config.SetInt("performance", "send_queue_limit_kb", 256);
+    config.SetString("performance", "send_overflow_policy", "disconnect");
 }
 
 int GatewayServerConfig::GetPort() {
@@ -441,6 +519,54 @@ bool GatewayServerConfig::GetFileOutput() {
     return GetConfig().GetBool("server", "file_output", true);
 }
 
+bool GatewayServerConfig::GetLogAsync() {
+    return GetConfig().GetBool("server", "log_async", true);
+}
+
+int GatewayServerConfig::GetLogBufferKb() {
+    return GetConfig().GetInt("server", "log_buffer_kb", 256);
+}
+
+std::string GatewayServerConfig::GetLogOverflowPolicy() {
+    return GetConfig().GetString("server", "log_overflow_policy", "block");
+}
+
+int GatewayServerConfig::GetLogFlushIntervalMs() {
+    return GetConfig().GetInt("server", "log_flush_interval_ms", 100);
+}
+
+bool GatewayServerConfig::GetLogBinary() {
+    return GetConfig().GetBool("server", "log_binary", false);
+}
+
+std::string GatewayServerConfig::GetLogBinaryFile() {
+    return GetConfig().GetString("server", "log_binary_file", "logs/gateway_server.blog");
+}
+
+int GatewayServerConfig::GetLogRotateSizeMb() {
+    return GetConfig().GetInt("server", "log_rotate_size_mb", 100);
+}
+
+int GatewayServerConfig::GetLogRotateIntervalMin() {
+    return GetConfig().GetInt("server", "log_rotate_interval_min", 1440);
+}
+
+int GatewayServerConfig::GetLogRetainFiles() {
+    return GetConfig().GetInt("server", "log_retain_files", 10);
+}
+
+int GatewayServerConfig::GetLogRetainTotalMb() {
+    return GetConfig().GetInt("server", "log_retain_total_mb", 1024);
+}
+
+bool GatewayServerConfig::GetLogCompress() {
+    return GetConfig().GetBool("server", "log_compress", true);
+}
+
+int GatewayServerConfig::GetIoThreads() {
+    return GetConfig().GetInt("performance", "io_threads", 4);
+}
+
 std::string GatewayServerConfig::GetLoadBalanceMethod() {
     return GetConfig().GetString("load_balance", "method", "round_robin");
 }
@@ -488,6 +614,14 @@ int GatewayServerConfig::GetRateLimitWindow() {
     return GetConfig().GetInt("rate_limit", "window", 60);
 }
 
+int GatewayServerConfig::GetSendQueueLimitKb() {
+    return GetConfig().GetInt("performance", "send_queue_limit_kb", 256);
+}
+
+std::string GatewayServerConfig::GetSendOverflowPolicy() {
+    return GetConfig().GetString("performance", "send_overflow_policy", "disconnect");
+}
+
 // ===========================================================================
 // GameServerConfig 구현
 // ===========================================================================
@@ -522,6 +656,17 @@ void GameServerConfig::LoadDefaults() {
     config.SetString("server", "log_file", "logs/game_server.log");
     config.SetBool("server", "console_output", true);
     config.SetBool("server", "file_output", true);
+    config.SetBool("server", "log_async", true);
+    config.SetInt("server", "log_buffer_kb", 256);
+    config.SetString("server", "log_overflow_policy", "block");
+    config.SetInt("server", "log_flush_interval_ms", 100);
+    config.SetBool("server", "log_binary", false);
+    config.SetString("server", "log_binary_file", "logs/game_server.blog");
+    config.SetInt("server", "log_rotate_size_mb", 100);
+    config.SetInt("server", "log_rotate_interval_min", 1440);
+    config.SetInt("server", "log_retain_files", 10);
+    config.SetInt("server", "log_retain_total_mb", 1024);
+    config.SetBool("server", "log_compress", true);
 
     // Game Logic 설정
     config.SetInt("game", "max_players_per_zone", 100);
@@ -535,6 +680,11 @@ void GameServerConfig::LoadDefaults() {
     config.SetInt("performance", "update_queue_size", 1000);
     config.SetBool("performance", "optimized_networking", true);
     config.SetInt("performance", "batch_size", 10);
+    config.SetInt("performance", "send_queue_limit_kb", 1024);
+    config.SetString("performance", "send_overflow_policy", "disconnect");
+    config.SetString("performance", "tick_catch_up_policy", "skip");
+    config.SetInt("performance", "max_catch_up_ticks", 5);
+    config.SetInt("performance", "job_threads", 0);
 
     // Zone Server 연결
     config.SetString("zones", "servers", "localhost:8004");
@@ -569,6 +719,50 @@ bool GameServerConfig::GetFileOutput() {
     return GetConfig().GetBool("server", "file_output", true);
 }
 
+bool GameServerConfig::GetLogAsync() {
+    return GetConfig().GetBool("server", "log_async", true);
+}
+
+int GameServerConfig::GetLogBufferKb() {
+    return GetConfig().GetInt("server", "log_buffer_kb", 256);
+}
+
+std::string GameServerConfig::GetLogOverflowPolicy() {
+    return GetConfig().GetString("server", "log_overflow_policy", "block");
+}
+
+int GameServerConfig::GetLogFlushIntervalMs() {
+    return GetConfig().GetInt("server", "log_flush_interval_ms", 100);
+}
+
+bool GameServerConfig::GetLogBinary() {
+    return GetConfig().GetBool("server", "log_binary", false);
+}
+
+std::string GameServerConfig::GetLogBinaryFile() {
+    return GetConfig().GetString("server", "log_binary_file", "logs/game_server.blog");
+}
+
+int GameServerConfig::GetLogRotateSizeMb() {
+    return GetConfig().GetInt("server", "log_rotate_size_mb", 100);
+}
+
+int GameServerConfig::GetLogRotateIntervalMin() {
+    return GetConfig().GetInt("server", "log_rotate_interval_min", 1440);
+}
+
+int GameServerConfig::GetLogRetainFiles() {
+    return GetConfig().GetInt("server", "log_retain_files", 10);
+}
+
+int GameServerConfig::GetLogRetainTotalMb() {
+    return GetConfig().GetInt("server", "log_retain_total_mb", 1024);
+}
+
+bool GameServerConfig::GetLogCompress() {
+    return GetConfig().GetBool("server", "log_compress", true);
+}
+
 int GameServerConfig::GetMaxPlayersPerZone() {
     return GetConfig().GetInt("game", "max_players_per_zone", 100);
 }
@@ -605,6 +799,26 @@ int GameServerConfig::GetBatchSize() {
     return GetConfig().GetInt("performance", "batch_size", 10);
 }
 
+int GameServerConfig::GetSendQueueLimitKb() {
+    return GetConfig().GetInt("performance", "send_queue_limit_kb", 1024);
+}
+
+std::string GameServerConfig::GetSendOverflowPolicy() {
+    return GetConfig().GetString("performance", "send_overflow_policy", "disconnect");
+}
+
+std::string GameServerConfig::GetTickCatchUpPolicy() {
+    return GetConfig().GetString("performance", "tick_catch_up_policy", "skip");
+}
+
+int GameServerConfig::GetMaxCatchUpTicks() {
+    return GetConfig().GetInt("performance", "max_catch_up_ticks", 5);
+}
+
+int GameServerConfig::GetJobThreads() {
+    return GetConfig().GetInt("performance", "job_threads", 0);
+}
+
 std::vector<std::string> GameServerConfig::GetZoneServers() {
     std::string servers = GetConfig().GetString("zones", "servers", "localhost:8004");
     std::vector<std::string> result;
@@ -656,11 +870,16 @@ void ZoneServerConfig::LoadDefaults() {
     config.SetInt("map", "height", 100);
     config.SetString("map", "file", "maps/zone_1.map");
     config.SetBool("map", "validation_enabled", true);
+    config.SetInt("map", "view_distance", 50);
 
     // NPC 설정
     config.SetInt("npc", "max_npcs", 200);
     config.SetInt("npc", "spawn_interval", 5);
     config.SetString("npc", "data_file", "data/npcs.json");
+    config.SetInt("npc", "path_budget_us", 500);
+    config.SetInt("npc", "path_cache_size", 1024);
+    config.SetInt("npc", "path_max_search_nodes", 65536);
+    config.SetInt("npc", "ai_budget_us", 2000);
 
     // Instance 설정
     config.SetBool("instance", "enabled", false);
@@ -671,6 +890,14 @@ void ZoneServerConfig::LoadDefaults() {
     config.SetDouble("physics", "tick_rate", 60.0);
     config.SetBool("physics", "collision_enabled", true);
     config.SetDouble("physics", "gravity", 9.81);
+    config.SetDouble("physics", "player_move_speed", 5.0);
+    config.SetDouble("physics", "network_send_rate", 20.0);
+    config.SetDouble("physics", "body_radius", 0.35);
+
+    // Performance 설정
+    config.SetInt("performance", "io_threads", 2);
+    config.SetInt("performance", "send_queue_limit_kb", 1024);
+    config.SetString("performance", "send_overflow_policy", "drop");
 }
 
 int ZoneServerConfig::GetPort() {
@@ -701,6 +928,18 @@ bool ZoneServerConfig::GetFileOutput() {
     return GetConfig().GetBool("server", "file_output", true);
 }
 
+int ZoneServerConfig::GetIoThreads() {
+    return GetConfig().GetInt("performance", "io_threads", 2);
+}
+
+int ZoneServerConfig::GetSendQueueLimitKb() {
+    return GetConfig().GetInt("performance", "send_queue_limit_kb", 1024);
+}
+
+std::string ZoneServerConfig::GetSendOverflowPolicy() {
+    return GetConfig().GetString("performance", "send_overflow_policy", "drop");
+}
+
 int ZoneServerConfig::GetMapWidth() {
     return GetConfig().GetInt("map", "width", 100);
 }
@@ -717,6 +956,10 @@ bool ZoneServerConfig::GetMapValidationEnabled() {
     return GetConfig().GetBool("map", "validation_enabled", true);
 }
 
+int ZoneServerConfig::GetViewDistance() {
+    return GetConfig().GetInt("map", "view_distance", 50);
+}
+
 int ZoneServerConfig::GetMaxNpcs() {
     return GetConfig().GetInt("npc", "max_npcs", 200);
 }
@@ -729,6 +972,22 @@ std::string ZoneServerConfig::GetNpcDataFile() {
     return GetConfig().GetString("npc", "data_file", "data/npcs.json");
 }
 
+int ZoneServerConfig::GetPathBudgetUs() {
+    return GetConfig().GetInt("npc", "path_budget_us", 500);
+}
+
+int ZoneServerConfig::GetPathCacheSize() {
+    return GetConfig().GetInt("npc", "path_cache_size", 1024);
+}
+
+int ZoneServerConfig::GetPathMaxSearchNodes() {
+    return GetConfig().GetInt("npc", "path_max_search_nodes", 65536);
+}
+
+int ZoneServerConfig::GetNpcAiBudgetUs() {
+    return GetConfig().GetInt("npc", "ai_budget_us", 2000);
+}
+
 bool ZoneServerConfig::GetInstanceEnabled() {
     return GetConfig().GetBool("instance", "enabled", false);
 }
@@ -753,4 +1012,16 @@ double ZoneServerConfig::GetGravity() {
     return GetConfig().GetDouble("physics", "gravity", 9.81);
 }
 
+double ZoneServerConfig::GetPlayerMoveSpeed() {
+    return GetConfig().GetDouble("physics", "player_move_speed", 5.0);
+}
+
+double ZoneServerConfig::GetNetworkSendRate() {
+    return GetConfig().GetDouble("physics", "network_send_rate", 20.0);
+}
+
+double ZoneServerConfig::GetBodyRadius() {
+    return GetConfig().GetDouble("physics", "body_radius", 0.35);
+}
+
 } // namespace Common
\ No newline at end of file
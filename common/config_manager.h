@@ -74,6 +74,18 @@ public:
     static std::string GetLogFile();
     static bool GetConsoleOutput();
     static bool GetFileOutput();
+    static bool GetLogAsync();                 // 비동기 로그 기록 스레드 사용
+    static int GetLogBufferKb();               // 스레드별 비동기 로그 버퍼 크기
+    static std::string GetLogOverflowPolicy(); // block, drop
+    static int GetLogFlushIntervalMs();        // 비동기 모드 파일 flush 주기 상한
+    static bool GetLogBinary();                // 바이너리 로그 (LogDecoder로 변환)
+    static std::string GetLogBinaryFile();
+    static int GetLogRotateSizeMb();           // 0이면 크기 기준 회전 없음
+    static int GetLogRotateIntervalMin();      // 0이면 시간 기준 회전 없음
+    static int GetLogRetainFiles();            // 남길 회전 파일 수
+    static int GetLogRetainTotalMb();          // 회전 파일 합계 상한
+    static bool GetLogCompress();              // 회전 파일 gzip 압축
+    static int GetIoThreads();
 
     // Database 설정 (Auth 서버용)
     static std::string GetDatabaseHost();
@@ -106,6 +118,18 @@ public:
     static std::string GetLogFile();
     static bool GetConsoleOutput();
     static bool GetFileOutput();
+    static bool GetLogAsync();                 // 비동기 로그 기록 스레드 사용
+    static int GetLogBufferKb();               // 스레드별 비동기 로그 버퍼 크기
+    static std::string GetLogOverflowPolicy(); // block, drop
+    static int GetLogFlushIntervalMs();        // 비동기 모드 파일 flush 주기 상한
+    static bool GetLogBinary();                // 바이너리 로그 (LogDecoder로 변환)
+    static std::string GetLogBinaryFile();
+    static int GetLogRotateSizeMb();           // 0이면 크기 기준 회전 없음
+    static int GetLogRotateIntervalMin();      // 0이면 시간 기준 회전 없음
+    static int GetLogRetainFiles();            // 남길 회전 파일 수
+    static int GetLogRetainTotalMb();          // 회전 파일 합계 상한
+    static bool GetLogCompress();              // 회전 파일 gzip 압축
+    static int GetIoThreads();
 
     // Load Balancing 설정
     static std::string GetLoadBalanceMethod(); // round_robin, least_connections, weighted
@@ -123,6 +147,10 @@ public:
     static int GetRateLimitRequests();
     static int GetRateLimitWindow();
 
+    // 송신 큐 설정
+    static int GetSendQueueLimitKb();
+    static std::string GetSendOverflowPolicy(); // disconnect, drop
+
 private:
     static ConfigManager& GetConfig();
     static void LoadDefaults();
@@ -141,6 +169,17 @@ public:
     static std::string GetLogFile();
     static bool GetConsoleOutput();
     static bool GetFileOutput();
+    static bool GetLogAsync();                 // 비동기 로그 기록 스레드 사용
+    static int GetLogBufferKb();               // 스레드별 비동기 로그 버퍼 크기
+    static std::string GetLogOverflowPolicy(); // block, drop
+    static int GetLogFlushIntervalMs();        // 비동기 모드 파일 flush 주기 상한
+    static bool GetLogBinary();                // 바이너리 로그 (LogDecoder로 변환)
+    static std::string GetLogBinaryFile();
+    static int GetLogRotateSizeMb();           // 0이면 크기 기준 회전 없음
+    static int GetLogRotateIntervalMin();      // 0이면 시간 기준 회전 없음
+    static int GetLogRetainFiles();            // 남길 회전 파일 수
+    static int GetLogRetainTotalMb();          // 회전 파일 합계 상한
+    static bool GetLogCompress();              // 회전 파일 gzip 압축
 
     // Game Logic 설정
     static int GetMaxPlayersPerZone();
@@ -154,6 +193,11 @@ public:
     static int GetUpdateQueueSize();
     static bool GetOptimizedNetworking();
     static int GetBatchSize();
+    static int GetSendQueueLimitKb();
+    static std::string GetSendOverflowPolicy(); // disconnect, drop
+    static std::string GetTickCatchUpPolicy();  // skip, catch_up
+    static int GetMaxCatchUpTicks();
+    static int GetJobThreads();                 // 틱 병렬 실행 워커 수 (0이면 코어 수 기반)
 
     // Zone Server 연결 설정
     static std::vector<std::string> GetZoneServers();
@@ -177,17 +221,25 @@ public:
     static std::string GetLogFile();
     static bool GetConsoleOutput();
     static bool GetFileOutput();
+    static int GetIoThreads();
+    static int GetSendQueueLimitKb();
+    static std::string GetSendOverflowPolicy(); // disconnect, drop
 
     // Map 설정
     static int GetMapWidth();
     static int GetMapHeight();
     static std::string GetMapFile();
     static bool GetMapValidationEnabled();
+    static int GetViewDistance();              // 위치 동기화 대상 반경 (AOI 격자 셀 크기)
 
     // NPC 설정
     static int GetMaxNpcs();
     static int GetNpcSpawnInterval();
     static std::string GetNpcDataFile();
+    static int GetPathBudgetUs();              // 틱당 경로 탐색 시간 예산
+    static int GetPathCacheSize();             // 최근 경로 LRU 캐시 항목 수
+    static int GetPathMaxSearchNodes();        // 질의 하나가 만들 수 있는 탐색 노드 한도
+    static int GetNpcAiBudgetUs();             // 틱당 NPC AI(생각) 시간 예산
 
     // Instance 설정
     static bool GetInstanceEnabled();
@@ -195,8 +247,11 @@ public:
     static int GetInstanceTimeout();
 
     // Physics 설정
-    static double GetPhysicsTickRate();
+    static double GetPhysicsTickRate();        // 존 틱 (이동 적분) 주기
     static bool GetCollisionEnabled();
+    static double GetPlayerMoveSpeed();        // 초당 타일
+    static double GetNetworkSendRate();        // 위치 전송 주기 (물리 틱보다 낮게, 사이 상태는 보간)
+    static double GetBodyRadius();             // 엔티티 간 충돌 반지름 (타일)
     static double GetGravity();
 
 private:
@@ -0,0 +1,151 @@
+// common/entity_store.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Common {
+
+// 세대 번호가 붙은 엔티티 핸들 - 슬롯이 재사용되면 세대가 올라가 이전 핸들은 무효가 된다
+struct EntityHandle {
+    static constexpr uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+
+    uint32_t index = kInvalidIndex;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != kInvalidIndex; }
+    bool operator==(const EntityHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
+
+namespace Detail {
+
+template<typename T, typename... Ts>
+struct TypeIndex;
+
+template<typename T, typename... Ts>
+struct TypeIndex<T, T, Ts...> : std::integral_constant<size_t, 0> {};
+
+template<typename T, typename U, typename... Ts>
+struct TypeIndex<T, U, Ts...> : std::integral_constant<size_t, 1 + TypeIndex<T, Ts...>::value> {};
+
+} // namespace Detail
+
+// 슬롯 맵 기반 구조체 배열(SoA) 엔티티 저장소
+// 컴포넌트 타입마다 빽빽한 배열(열)을 하나씩 두고, 살아있는 엔티티는 항상 [0, Size()) 구간에 모여 있다.
+// 삭제는 마지막 원소를 빈자리로 옮기는 swap-and-pop이므로 밀집 인덱스는 삭제 시 바뀔 수 있다 -
+// 오래 보관할 때는 핸들을 쓰고, 틱 루프에서는 Column<T>()를 선형으로 훑는다.
+// 자주 쓰는 컴포넌트(위치 등)와 드물게 쓰는 컴포넌트(주소, 이름)를 다른 타입으로 나눠 두면
+// 틱 루프가 필요한 열만 건드린다. 컴포넌트 타입은 서로 달라야 한다.
+// 스레드 안전하지 않다 - 생성/삭제는 소유 스레드에서만 하고, 그 사이에는 여러 스레드가
+// 서로 다른 엔티티의 컴포넌트를 동시에 수정해도 된다.
+template<typename... Components>
+class EntityStore {
+public:
+    EntityHandle Create(Components... components) {
+        uint32_t slot_index;
+        if (!free_slots_.empty()) {
+            slot_index = free_slots_.back();
+            free_slots_.pop_back();
+        } else {
+            slot_index = static_cast<uint32_t>(slots_.size());
+            slots_.push_back(Slot{EntityHandle::kInvalidIndex, 0});
+        }
+
+        Slot& slot = slots_[slot_index];
+        slot.dense = static_cast<uint32_t>(dense_to_slot_.size());
+        dense_to_slot_.push_back(slot_index);
+        (std::get<std::vector<Components>>(columns_).push_back(std::move(components)), ...);
+
+        return EntityHandle{slot_index, slot.generation};
+    }
+
+    bool Destroy(EntityHandle handle) {
+        if (!IsAlive(handle)) {
+            return false;
+        }
+
+        Slot& slot = slots_[handle.index];
+        uint32_t dense = slot.dense;
+        uint32_t last = static_cast<uint32_t>(dense_to_slot_.size() - 1);
+
+        // 마지막 엔티티를 빈자리로 옮긴다
+        if (dense != last) {
+            MoveComponents(last, dense, std::index_sequence_for<Components...>());
+            dense_to_slot_[dense] = dense_to_slot_[last];
+            slots_[dense_to_slot_[dense]].dense = dense;
+        }
+        (std::get<std::vector<Components>>(columns_).pop_back(), ...);
+        dense_to_slot_.pop_back();
+
+        slot.dense = EntityHandle::kInvalidIndex;
+        ++slot.generation;
+        free_slots_.push_back(handle.index);
+        return true;
+    }
+
+    bool IsAlive(EntityHandle handle) const {
+        return handle.index < slots_.size() &&
+               slots_[handle.index].generation == handle.generation &&
+               slots_[handle.index].dense != EntityHandle::kInvalidIndex;
+    }
+
+    // 살아있지 않으면 kInvalidIndex
+    size_t DenseIndex(EntityHandle handle) const {
+        return IsAlive(handle) ? slots_[handle.index].dense : EntityHandle::kInvalidIndex;
+    }
+
+    EntityHandle HandleAt(size_t dense) const {
+        uint32_t slot_index = dense_to_slot_[dense];
+        return EntityHandle{slot_index, slots_[slot_index].generation};
+    }
+
+    template<typename T>
+    T* Find(EntityHandle handle) {
+        size_t dense = DenseIndex(handle);
+        return dense == EntityHandle::kInvalidIndex ? nullptr : &Column<T>()[dense];
+    }
+
+    template<typename T>
+    std::vector<T>& Column() {
+        return std::get<Detail::TypeIndex<T, Components...>::value>(columns_);
+    }
+
+    template<typename T>
+    const std::vector<T>& Column() const {
+        return std::get<Detail::TypeIndex<T, Components...>::value>(columns_);
+    }
+
+    size_t Size() const { return dense_to_slot_.size(); }
+    bool Empty() const { return dense_to_slot_.empty(); }
+
+    void Reserve(size_t count) {
+        slots_.reserve(count);
+        dense_to_slot_.reserve(count);
+        (std::get<std::vector<Components>>(columns_).reserve(count), ...);
+    }
+
+private:
+    struct Slot {
+        uint32_t dense;         // 밀집 배열 위치 (죽은 슬롯은 kInvalidIndex)
+        uint32_t generation;
+    };
+
+    template<size_t... Indices>
+    void MoveComponents(size_t from, size_t to, std::index_sequence<Indices...>) {
+        ((std::get<Indices>(columns_)[to] = std::move(std::get<Indices>(columns_)[from])), ...);
+    }
+
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> free_slots_;
+    std::vector<uint32_t> dense_to_slot_;
+    std::tuple<std::vector<Components>...> columns_;
+};
+
+} // namespace Common
@@ -0,0 +1,169 @@
+// common/job_system.cpp
+#include "job_system.h"
+#include <algorithm>
+
+namespace Common {
+
+namespace {
+
+// 현재 스레드가 어떤 JobSystem의 몇 번째 큐를 쓰는지 (워커가 아니면 0번 공용 큐)
+thread_local const JobSystem* t_owner = nullptr;
+thread_local size_t t_queue_index = 0;
+
+// 스레드별 잡 링 버퍼
+thread_local std::unique_ptr<JobSystem::Job[]> t_job_ring;
+thread_local size_t t_job_cursor = 0;
+
+constexpr int kSpinsBeforeSleep = 64;
+
+} // anonymous namespace
+
+JobSystem::JobSystem(int worker_count)
+    : worker_count_(worker_count > 0
+                    ? worker_count
+                    : std::max(0, static_cast<int>(std::thread::hardware_concurrency()) - 1))
+    , running_(true)
+    , queued_jobs_(0)
+    , sleeping_workers_(0)
+    , stolen_jobs_(0) {
+    for (int i = 0; i <= worker_count_; ++i) {
+        queues_.push_back(std::make_unique<WorkQueue>());
+    }
+    for (int i = 1; i <= worker_count_; ++i) {
+        threads_.emplace_back(&JobSystem::WorkerThread, this, static_cast<size_t>(i));
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        running_ = false;
+    }
+    sleep_cv_.notify_all();
+    for (auto& thread : threads_) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+JobSystem::Job* JobSystem::AllocateJob(Job* parent) {
+    if (!t_job_ring) {
+        t_job_ring.reset(new Job[kJobsPerThread]);
+    }
+    Job* job = &t_job_ring[t_job_cursor++ & (kJobsPerThread - 1)];
+    job->function = nullptr;
+    job->parent = parent;
+    job->unfinished.store(1, std::memory_order_relaxed);
+    if (parent) {
+        parent->unfinished.fetch_add(1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+void JobSystem::Run(Job* job) {
+    size_t index = t_owner == this ? t_queue_index : 0;
+    {
+        WorkQueue& queue = *queues_[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(job);
+    }
+    // 잠들려는 워커와 교차하므로 두 카운터 모두 seq_cst로 다룬다
+    queued_jobs_.fetch_add(1);
+
+    if (sleeping_workers_.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        sleep_cv_.notify_one();
+    }
+}
+
+void JobSystem::Wait(const Job* job) {
+    size_t index = t_owner == this ? t_queue_index : 0;
+    while (job->unfinished.load(std::memory_order_acquire) > 0) {
+        if (Job* next = PopOrSteal(index)) {
+            Execute(next);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+JobSystem::Job* JobSystem::PopOrSteal(size_t self) {
+    if (queued_jobs_.load(std::memory_order_acquire) <= 0) {
+        return nullptr;
+    }
+
+    // 자기 큐는 뒤에서 (최근에 넣은 잡이 캐시에 남아있을 가능성이 높다)
+    {
+        WorkQueue& queue = *queues_[self];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            Job* job = queue.jobs.back();
+            queue.jobs.pop_back();
+            queued_jobs_.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    // 다른 큐는 앞에서 훔친다 (오래된 잡일수록 큰 작업 단위일 가능성이 높다)
+    for (size_t offset = 1; offset < queues_.size(); ++offset) {
+        WorkQueue& queue = *queues_[(self + offset) % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            Job* job = queue.jobs.front();
+            queue.jobs.pop_front();
+            queued_jobs_.fetch_sub(1, std::memory_order_relaxed);
+            stolen_jobs_.fetch_add(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::Execute(Job* job) {
+    if (job->function) {
+        job->function(job);
+    }
+    Finish(job);
+}
+
+void JobSystem::Finish(Job* job) {
+    while (job && job->unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        job = job->parent;
+    }
+}
+
+void JobSystem::WorkerThread(size_t index) {
+    t_owner = this;
+    t_queue_index = index;
+
+    int idle_spins = 0;
+    while (running_.load(std::memory_order_acquire)) {
+        if (Job* job = PopOrSteal(index)) {
+            Execute(job);
+            idle_spins = 0;
+            continue;
+        }
+
+        if (++idle_spins < kSpinsBeforeSleep) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // 틱 사이에는 코어를 점유하지 않도록 잠든다
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        sleeping_workers_.fetch_add(1);
+        sleep_cv_.wait(lock, [this]() {
+            return !running_.load() || queued_jobs_.load() > 0;
+        });
+        sleeping_workers_.fetch_sub(1);
+        idle_spins = 0;
+    }
+}
+
+size_t JobSystem::DefaultGrain(size_t count) const {
+    size_t chunks = static_cast<size_t>(worker_count_ + 1) * 4;
+    return std::max<size_t>(1, (count + chunks - 1) / chunks);
+}
+
+} // namespace Common
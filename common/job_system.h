@@ -0,0 +1,123 @@
+// common/job_system.h
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Common {
+
+// 작업 훔치기(work-stealing) 방식의 잡 스케줄러
+// 워커마다 덱을 두고, 자기 덱은 뒤에서 꺼내고(LIFO) 일이 없으면 다른 워커 덱의 앞에서 훔친다(FIFO).
+// 잡은 부모를 가질 수 있으며 부모는 자신과 모든 자식이 끝나야 완료된다.
+// Wait을 호출한 스레드도 기다리는 동안 잡을 실행하므로 틱 스레드가 놀지 않는다.
+//
+// 잡은 스레드별 링 버퍼에서 할당된다 - 한 스레드가 동시에 진행 중인 잡은 kJobsPerThread 미만이어야 하며,
+// 잡 본문(람다)은 kJobDataSize 바이트 이하이고 소멸자가 없어야 한다 (참조와 값만 캡처).
+class JobSystem {
+public:
+    static constexpr size_t kJobsPerThread = 4096;
+    static constexpr size_t kJobDataSize = 48;
+
+    struct Job;
+
+    // worker_count: 전용 워커 스레드 수 (0이면 코어 수 - 1, 호출 스레드가 나머지 하나를 맡는다)
+    explicit JobSystem(int worker_count = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    template<typename F>
+    Job* CreateJob(F&& function) {
+        return CreateChildJob(nullptr, std::forward<F>(function));
+    }
+
+    template<typename F>
+    Job* CreateChildJob(Job* parent, F&& function) {
+        using Function = std::decay_t<F>;
+        static_assert(sizeof(Function) <= kJobDataSize, "job function captures too much state");
+        static_assert(std::is_trivially_destructible<Function>::value,
+                      "job function must be trivially destructible");
+
+        Job* job = AllocateJob(parent);
+        new (job->data) Function(std::forward<F>(function));
+        job->function = [](Job* self) {
+            (*std::launder(reinterpret_cast<Function*>(self->data)))();
+        };
+        return job;
+    }
+
+    Job* CreateEmptyJob(Job* parent = nullptr) { return AllocateJob(parent); }
+
+    void Run(Job* job);
+    void Wait(const Job* job);     // 완료될 때까지 다른 잡을 실행하며 대기
+
+    // [0, count)를 grain 크기 조각으로 나눠 function(begin, end)를 병렬 실행하고 모두 끝날 때까지 대기
+    // grain이 0이면 워커 수에 맞춰 자동으로 정한다
+    template<typename F>
+    void ParallelFor(size_t count, size_t grain, const F& function) {
+        if (count == 0) {
+            return;
+        }
+        if (grain == 0) {
+            grain = DefaultGrain(count);
+        }
+        if (count <= grain || worker_count_ == 0) {
+            function(size_t(0), count);
+            return;
+        }
+
+        Job* root = CreateEmptyJob();
+        for (size_t begin = 0; begin < count; begin += grain) {
+            size_t end = begin + grain < count ? begin + grain : count;
+            Run(CreateChildJob(root, [&function, begin, end]() { function(begin, end); }));
+        }
+        Run(root);
+        Wait(root);
+    }
+
+    int GetWorkerCount() const { return worker_count_; }
+    uint64_t GetStolenCount() const { return stolen_jobs_.load(std::memory_order_relaxed); }
+
+    struct Job {
+        void (*function)(Job*);
+        Job* parent;
+        std::atomic<int32_t> unfinished;
+        alignas(std::max_align_t) unsigned char data[kJobDataSize];
+    };
+
+private:
+    // 워커 0은 외부(비워커) 스레드들이 공유하는 큐
+    struct alignas(64) WorkQueue {
+        std::mutex mutex;
+        std::deque<Job*> jobs;
+    };
+
+    Job* AllocateJob(Job* parent);
+    Job* PopOrSteal(size_t self);
+    void Execute(Job* job);
+    void Finish(Job* job);
+    void WorkerThread(size_t index);
+    size_t DefaultGrain(size_t count) const;
+
+    int worker_count_;
+    std::vector<std::unique_ptr<WorkQueue>> queues_;
+    std::vector<std::thread> threads_;
+
+    std::atomic<bool> running_;
+    std::atomic<int64_t> queued_jobs_;
+    std::atomic<int> sleeping_workers_;
+    std::atomic<uint64_t> stolen_jobs_;
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+};
+
+} // namespace Common
@@ -1,30 +1,258 @@
 // common/log_manager.cpp
 #include "log_manager.h"
+#include "coarse_clock.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
 #include <iostream>
 #include <filesystem>
 
 namespace Common {
 
+namespace {
+
+enum LogRecordType : uint8_t {
+    RECORD_TEXT,
+    RECORD_PADDING,     // 버퍼 끝까지 남은 공간을 건너뛴다
+    RECORD_BINARY       // 바이너리 모드 - message 자리에 인자 payload
+};
+
+// 링 버퍼 안의 기록 헤더 - 뒤에 category, message 바이트가 이어지고 전체는 8바이트 정렬
+// 앞 8바이트(size, type)만으로 패딩을 표현할 수 있어 버퍼 끝의 짧은 틈에도 쓸 수 있다.
+struct LogRecordHeader {
+    uint32_t size;
+    uint16_t category_length;
+    uint8_t type;
+    uint8_t level;
+    uint32_t message_length;
+    uint32_t site_id;           // RECORD_BINARY
+    int64_t timestamp_ns;       // NowNanos (steady_clock 기준, ms 해상도) - 출력할 때 벽시계로 바꾼다
+};
+
+static_assert(sizeof(LogRecordHeader) == 24, "LogRecordHeader layout");
+
+constexpr size_t kRecordAlignment = 8;
+constexpr size_t kMinLogBufferSize = 4096;
+
+size_t AlignRecord(size_t size) {
+    return (size + kRecordAlignment - 1) & ~(kRecordAlignment - 1);
+}
+
+std::time_t WallSeconds() {
+    return static_cast<std::time_t>(WallNanos() / 1000000000);
+}
+
+size_t RoundUpPowerOfTwo(size_t value) {
+    size_t result = kMinLogBufferSize;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+template<typename T>
+void AppendValue(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// 바이너리 로그 파일 레코드 (binary_log.h 형식)
+void AppendSiteRecord(std::string& out, const LogSiteInfo& site) {
+    AppendValue<uint8_t>(out, BINARY_LOG_SITE);
+    AppendValue<uint32_t>(out, site.id);
+    AppendValue<uint8_t>(out, site.level);
+    AppendValue<uint8_t>(out, static_cast<uint8_t>(site.arg_types.size()));
+    AppendValue<uint16_t>(out, static_cast<uint16_t>(site.category.size()));
+    AppendValue<uint16_t>(out, static_cast<uint16_t>(site.format.size()));
+    AppendValue<uint16_t>(out, static_cast<uint16_t>(site.file.size()));
+    AppendValue<uint32_t>(out, site.line);
+    out.append(reinterpret_cast<const char*>(site.arg_types.data()), site.arg_types.size());
+    out += site.category;
+    out += site.format;
+    out += site.file;
+}
+
+void AppendEventRecord(std::string& out, uint32_t site_id, int64_t steady_ns, const void* payload, size_t size) {
+    AppendValue<uint8_t>(out, BINARY_LOG_EVENT);
+    AppendValue<uint32_t>(out, site_id);
+    AppendValue<int64_t>(out, steady_ns);
+    AppendValue<uint16_t>(out, static_cast<uint16_t>(size));
+    out.append(static_cast<const char*>(payload), size);
+}
+
+} // anonymous namespace
+
+// 스레드 하나 전용 바이트 링 버퍼 (단일 생산자/단일 소비자)
+// head/tail은 계속 증가하는 바이트 위치이고 실제 위치는 & mask. 생산자만 head를, 소비자만 tail을 쓴다.
+class LogManager::LogRing {
+public:
+    explicit LogRing(size_t capacity)
+        : buffer_(capacity / sizeof(uint64_t))
+        , capacity_(capacity)
+        , mask_(capacity - 1)
+        , head_(0)
+        , cached_tail_(0)
+        , tail_(0)
+        , orphaned_(false) {
+    }
+
+    // 생산자 - 공간이 없으면 false
+    bool TryPush(uint8_t type, LogLevel level, uint32_t site_id, int64_t timestamp_ns,
+                 const char* category, size_t category_size, const void* message, size_t message_size) {
+        // 한 기록이 버퍼 절반을 넘지 않도록 메시지를 자른다 (바이너리 payload는 kMaxLogPayload 이하라 잘리지 않는다)
+        size_t category_length = std::min<size_t>(category_size, 255);
+        size_t max_message = capacity_ / 2 - sizeof(LogRecordHeader) - category_length;
+        size_t message_length = std::min(message_size, max_message);
+        size_t size = AlignRecord(sizeof(LogRecordHeader) + category_length + message_length);
+
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        size_t offset = static_cast<size_t>(head & mask_);
+        size_t to_end = capacity_ - offset;
+        size_t needed = size > to_end ? size + to_end : size;
+        if (capacity_ - (head - cached_tail_) < needed) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (capacity_ - (head - cached_tail_) < needed) {
+                return false;
+            }
+        }
+
+        uint8_t* data = Data();
+        if (size > to_end) {
+            LogRecordHeader padding{};
+            padding.size = static_cast<uint32_t>(to_end);
+            padding.type = RECORD_PADDING;
+            std::memcpy(data + offset, &padding, kRecordAlignment);
+            head += to_end;
+            offset = 0;
+        }
+
+        LogRecordHeader header{};
+        header.size = static_cast<uint32_t>(size);
+        header.category_length = static_cast<uint16_t>(category_length);
+        header.type = type;
+        header.level = static_cast<uint8_t>(level);
+        header.message_length = static_cast<uint32_t>(message_length);
+        header.site_id = site_id;
+        header.timestamp_ns = timestamp_ns;
+        std::memcpy(data + offset, &header, sizeof(header));
+        std::memcpy(data + offset + sizeof(header), category, category_length);
+        std::memcpy(data + offset + sizeof(header) + category_length, message, message_length);
+
+        head_.store(head + size, std::memory_order_release);
+        return true;
+    }
+
+    // 생산자 - 기록 스레드를 미리 깨울지 판단
+    bool MoreThanHalfFull() const {
+        return head_.load(std::memory_order_relaxed) - cached_tail_ > capacity_ / 2;
+    }
+
+    // 소비자 - [tail, head) 범위의 기록을 순서대로 넘긴다. 다 쓴 뒤 Release(end)로 공간을 돌려준다.
+    template<typename Visitor>
+    uint64_t Visit(Visitor&& visitor) const {
+        uint64_t position = tail_.load(std::memory_order_relaxed);
+        uint64_t end = head_.load(std::memory_order_acquire);
+        const uint8_t* data = Data();
+        while (position < end) {
+            const uint8_t* record = data + (position & mask_);
+            LogRecordHeader header;
+            std::memcpy(&header, record, kRecordAlignment);
+            if (header.type != RECORD_PADDING) {
+                std::memcpy(&header, record, sizeof(header));
+                visitor(header, record + sizeof(header));
+            }
+            position += header.size;
+        }
+        return end;
+    }
+
+    void Release(uint64_t position) { tail_.store(position, std::memory_order_release); }
+    bool Empty() const { return tail_.load(std::memory_order_acquire) == head_.load(std::memory_order_acquire); }
+
+    // 스레드 종료 후 재사용 표시
+    bool IsOrphaned() const { return orphaned_.load(std::memory_order_acquire); }
+    void SetOrphaned(bool orphaned) { orphaned_.store(orphaned, std::memory_order_release); }
+
+private:
+    uint8_t* Data() { return reinterpret_cast<uint8_t*>(buffer_.data()); }
+    const uint8_t* Data() const { return reinterpret_cast<const uint8_t*>(buffer_.data()); }
+
+    std::vector<uint64_t> buffer_;  // 8바이트 정렬 보장
+    size_t capacity_;
+    size_t mask_;
+
+    alignas(64) std::atomic<uint64_t> head_;
+    uint64_t cached_tail_;          // 생산자 전용 - tail_을 매번 읽지 않도록
+    alignas(64) std::atomic<uint64_t> tail_;
+    std::atomic<bool> orphaned_;
+};
+
+// 기록 스레드가 정렬하는 대기 기록 - 포인터는 해당 링의 Release 전까지 유효
+struct LogManager::PendingRecord {
+    int64_t timestamp_ns;
+    size_t ring_order;          // 같은 시각이면 링 안 순서 유지
+    LogLevel level;
+    uint8_t type;
+    uint32_t site_id;
+    const LogSiteInfo* site;    // RECORD_BINARY - 정렬 전에 채운다
+    const char* category;
+    size_t category_length;
+    const char* message;
+    size_t message_length;
+};
+
+LogOverflowPolicy ParseLogOverflowPolicy(const std::string& policy) {
+    if (policy == "block") return LogOverflowPolicy::BLOCK;
+    return LogOverflowPolicy::DROP;
+}
+
 LogManager& LogManager::Instance() {
     static LogManager instance;
     return instance;
 }
 
 LogManager::LogManager()
-    : min_log_level_(LogLevel::INFO)
+    : min_log_level_(static_cast<int>(LogLevel::INFO))
     , console_output_(true)
-    , file_output_(false) {
+    , file_output_(false)
+    , log_file_bytes_(0)
+    , log_next_rotation_(0)
+    , binary_file_bytes_(0)
+    , binary_next_rotation_(0)
+    , rotations_(0)
+    , async_(false)
+    , async_producers_(0)
+    , buffer_size_(kDefaultLogBufferSize)
+    , overflow_policy_(LogOverflowPolicy::DROP)
+    , flush_interval_(100)
+    , dropped_(0)
+    , reported_dropped_(0)
+    , writer_running_(false)
+    , wake_requested_(false)
+    , flush_requested_(0)
+    , flush_completed_(0)
+    , binary_(false)
+    , sites_written_(0) {
+    int64_t system_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    int64_t steady_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    wall_offset_ns_ = system_ns - steady_ns;
 }
 
 LogManager::~LogManager() {
+    StopWriter();
+    archiver_.Stop();
     if (log_file_.is_open()) {
         log_file_.close();
     }
+    if (binary_file_.is_open()) {
+        binary_file_.close();
+    }
 }
 
 void LogManager::SetLogLevel(LogLevel level) {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    min_log_level_ = level;
+    min_log_level_.store(static_cast<int>(level), std::memory_order_relaxed);
 }
 
 void LogManager::SetConsoleOutput(bool enabled) {
@@ -66,6 +294,11 @@ void LogManager::SetFileOutput(bool enabled, const std::string& filename) {
         if (!log_file_.is_open()) {
             std::cerr << "Failed to open log file: " << log_filename_ << std::endl;
             file_output_ = false;
+        } else {
+            std::error_code error;
+            auto size = std::filesystem::file_size(log_filename_, error);
+            log_file_bytes_ = error ? 0 : static_cast<uint64_t>(size);
+            log_next_rotation_ = NextLogRotationTime(WallSeconds(), rotation_.interval);
         }
     } else {
         if (log_file_.is_open()) {
@@ -74,19 +307,510 @@ void LogManager::SetFileOutput(bool enabled, const std::string& filename) {
     }
 }
 
+void LogManager::SetBinaryOutput(bool enabled, const std::string& filename) {
+    if (!enabled) {
+        // 새 호출은 텍스트 경로로 보내고 버퍼에 남은 바이너리 기록을 쓴 뒤 닫는다
+        binary_.store(false, std::memory_order_release);
+        Flush();
+        std::lock_guard<std::mutex> lock(log_mutex_);
+        if (binary_file_.is_open()) {
+            binary_file_.close();
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(log_mutex_);
+        if (binary_file_.is_open()) {
+            binary_file_.close();
+        }
+        binary_filename_ = filename.empty() ? "mmorpg_server.blog" : filename;
+
+        std::filesystem::path log_path(binary_filename_);
+        auto parent_path = log_path.parent_path();
+        if (!parent_path.empty() && !std::filesystem::exists(parent_path)) {
+            std::filesystem::create_directories(parent_path);
+        }
+
+        if (!OpenBinaryFileLocked()) {
+            return;
+        }
+    }
+    binary_.store(true, std::memory_order_release);
+}
+
+bool LogManager::OpenBinaryFileLocked() {
+    // 기존 파일에는 새 세션 헤더를 붙여 이어 쓴다 - 지점 정의도 처음부터 다시 쓴다
+    binary_file_.open(binary_filename_, std::ios::out | std::ios::app | std::ios::binary);
+    if (!binary_file_.is_open()) {
+        std::cerr << "Failed to open binary log file: " << binary_filename_ << std::endl;
+        return false;
+    }
+    std::error_code error;
+    auto size = std::filesystem::file_size(binary_filename_, error);
+    binary_file_bytes_ = error ? 0 : static_cast<uint64_t>(size);
+    binary_next_rotation_ = NextLogRotationTime(WallSeconds(), rotation_.interval);
+
+    BinaryLogFileHeader header{};
+    header.magic = kBinaryLogMagic;
+    header.version = kBinaryLogVersion;
+    header.steady_origin_ns = NowNanos();
+    header.system_origin_ns = header.steady_origin_ns + wall_offset_ns_;
+    binary_file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    binary_file_.flush();
+    binary_file_bytes_ += sizeof(header);
+    sites_written_ = 0;
+    return true;
+}
+
+void LogManager::SetRotation(const LogRotationPolicy& policy) {
+    if (policy.Enabled() && !IsAsync()) {
+        std::cerr << "Log rotation requires async logging (log_async = true) - rotation is disabled" << std::endl;
+    }
+    std::lock_guard<std::mutex> lock(log_mutex_);
+    rotation_ = policy;
+    std::time_t now = WallSeconds();
+    log_next_rotation_ = NextLogRotationTime(now, rotation_.interval);
+    binary_next_rotation_ = NextLogRotationTime(now, rotation_.interval);
+}
+
+// 기록 스레드(DrainRings)에서만 호출 - 동기 모드에서는 로그를 남기는 스레드가 파일 작업을 기다리지 않도록 회전하지 않는다
+void LogManager::RotateIfNeededLocked() {
+    if (!rotation_.Enabled()) {
+        return;
+    }
+    std::time_t now = WallSeconds();
+    if (log_file_.is_open() &&
+        ((rotation_.max_file_bytes > 0 && log_file_bytes_ >= rotation_.max_file_bytes) || now >= log_next_rotation_)) {
+        RotateTextFileLocked(now);
+    }
+    if (binary_file_.is_open() &&
+        ((rotation_.max_file_bytes > 0 && binary_file_bytes_ >= rotation_.max_file_bytes) ||
+         now >= binary_next_rotation_)) {
+        RotateBinaryFileLocked(now);
+    }
+}
+
+void LogManager::RotateTextFileLocked(std::time_t now) {
+    log_file_.close();
+    std::string rotated = log_rotation_names_.Next(log_filename_, now);
+    std::error_code error;
+    std::filesystem::rename(log_filename_, rotated, error);
+    if (error) {
+        // 이름을 못 바꾸면 같은 파일에 계속 쓰고 다음 기준까지 미룬다
+        std::cerr << "Failed to rotate log file: " << log_filename_ << " (" << error.message() << ")" << std::endl;
+        log_file_.open(log_filename_, std::ios::out | std::ios::app);
+        log_file_bytes_ = 0;
+        log_next_rotation_ = NextLogRotationTime(now, rotation_.interval);
+        return;
+    }
+
+    log_file_.open(log_filename_, std::ios::out | std::ios::trunc);
+    if (!log_file_.is_open()) {
+        std::cerr << "Failed to open log file: " << log_filename_ << std::endl;
+        file_output_ = false;
+    }
+    log_file_bytes_ = 0;
+    log_next_rotation_ = NextLogRotationTime(now, rotation_.interval);
+    rotations_.fetch_add(1, std::memory_order_relaxed);
+    archiver_.Submit(log_filename_, rotated, rotation_);
+}
+
+void LogManager::RotateBinaryFileLocked(std::time_t now) {
+    binary_file_.close();
+    std::string rotated = binary_rotation_names_.Next(binary_filename_, now);
+    std::error_code error;
+    std::filesystem::rename(binary_filename_, rotated, error);
+    if (error) {
+        std::cerr << "Failed to rotate binary log file: " << binary_filename_ << " (" << error.message() << ")"
+                  << std::endl;
+    } else {
+        rotations_.fetch_add(1, std::memory_order_relaxed);
+        archiver_.Submit(binary_filename_, rotated, rotation_);
+    }
+
+    // 새 파일은 헤더와 지점 정의부터 다시 시작해 혼자서도 디코딩된다
+    if (!OpenBinaryFileLocked()) {
+        binary_.store(false, std::memory_order_release);
+        return;
+    }
+    if (error) {
+        binary_file_bytes_ = 0;
+    }
+}
+
+void LogManager::SetAsyncMode(bool enabled, size_t buffer_size, LogOverflowPolicy policy,
+                              std::chrono::milliseconds flush_interval) {
+    if (!enabled) {
+        StopWriter();
+        std::lock_guard<std::mutex> lock(log_mutex_);
+        if (rotation_.Enabled()) {
+            std::cerr << "Log rotation requires async logging (log_async = true) - rotation is disabled" << std::endl;
+        }
+        return;
+    }
+
+    StopWriter();
+    {
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        buffer_size_ = RoundUpPowerOfTwo(buffer_size);
+    }
+    overflow_policy_ = policy;
+    flush_interval_ = std::max(flush_interval, std::chrono::milliseconds(1));
+    writer_running_ = true;
+    writer_thread_ = std::thread(&LogManager::WriterLoop, this);
+    async_.store(true, std::memory_order_release);
+}
+
+void LogManager::StopWriter() {
+    if (!writer_thread_.joinable()) {
+        return;
+    }
+    // 새 로그는 동기 경로로 보내고, 이미 PushAsync에 들어온 스레드가 밀어 넣기를 마칠 때까지 기다린다.
+    // 그 뒤에 멈춰야 기록 스레드의 마지막 비우기가 종료 직전 로그까지 담는다.
+    async_.store(false, std::memory_order_seq_cst);
+    while (async_producers_.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+    {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        writer_running_ = false;
+    }
+    writer_cv_.notify_one();
+    writer_thread_.join();
+}
+
+void LogManager::Flush() {
+    if (!IsAsync()) {
+        std::lock_guard<std::mutex> lock(log_mutex_);
+        if (log_file_.is_open()) {
+            log_file_.flush();
+        }
+        if (binary_file_.is_open()) {
+            binary_file_.flush();
+        }
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(writer_mutex_);
+    uint64_t ticket = ++flush_requested_;
+    writer_cv_.notify_one();
+    flushed_cv_.wait(lock, [this, ticket] { return flush_completed_ >= ticket || !writer_running_; });
+}
+
+LogManager::LogRing* LogManager::AcquireThreadRing() {
+    // 스레드가 끝나면 버퍼를 재사용 가능으로 표시 - 남은 기록은 기록 스레드가 계속 비운다
+    struct ThreadRing {
+        LogRing* ring = nullptr;
+        ~ThreadRing() {
+            if (ring) {
+                ring->SetOrphaned(true);
+            }
+        }
+    };
+    thread_local ThreadRing thread_ring;
+    if (thread_ring.ring) {
+        return thread_ring.ring;
+    }
+
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    for (const auto& ring : rings_) {
+        if (ring->IsOrphaned() && ring->Empty()) {
+            ring->SetOrphaned(false);
+            thread_ring.ring = ring.get();
+            return thread_ring.ring;
+        }
+    }
+    rings_.push_back(std::make_unique<LogRing>(buffer_size_));
+    thread_ring.ring = rings_.back().get();
+    return thread_ring.ring;
+}
+
+bool LogManager::PushAsync(uint8_t type, LogLevel level, uint32_t site_id, const char* category,
+                           size_t category_length, const void* message, size_t message_length) {
+    // 들어왔음을 먼저 알리고 모드를 다시 확인 - StopWriter와 엇갈려도 기록이 링에 남지 않는다
+    struct ProducerScope {
+        std::atomic<uint32_t>& producers;
+        explicit ProducerScope(std::atomic<uint32_t>& count) : producers(count) {
+            producers.fetch_add(1, std::memory_order_seq_cst);
+        }
+        ~ProducerScope() { producers.fetch_sub(1, std::memory_order_release); }
+    } scope(async_producers_);
+    if (!async_.load(std::memory_order_seq_cst)) {
+        return false;
+    }
+
+    LogRing* ring = AcquireThreadRing();
+    int64_t timestamp_ns = NowNanos();
+
+    while (!ring->TryPush(type, level, site_id, timestamp_ns, category, category_length, message, message_length)) {
+        if (overflow_policy_ == LogOverflowPolicy::DROP || !writer_running_.load(std::memory_order_relaxed)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        // BLOCK - 기록 스레드를 깨우고 자리가 날 때까지 양보
+        wake_requested_.store(true, std::memory_order_relaxed);
+        writer_cv_.notify_one();
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+
+    // 절반을 넘기면 flush 주기를 기다리지 않고 기록 스레드를 깨운다 (깨우기 요청은 한 번만)
+    if (ring->MoreThanHalfFull() && !wake_requested_.exchange(true, std::memory_order_relaxed)) {
+        writer_cv_.notify_one();
+    }
+    return true;
+}
+
+uint32_t LogManager::RegisterSite(LogSite& site, LogLevel level, const char* category, const char* format,
+                                  const char* file, int line, const uint8_t* arg_types, size_t arg_count) {
+    std::lock_guard<std::mutex> lock(sites_mutex_);
+    uint32_t site_id = site.id.load(std::memory_order_relaxed);
+    if (site_id != 0) {
+        return site_id;
+    }
+
+    LogSiteInfo info;
+    info.id = static_cast<uint32_t>(sites_.size() + 1);
+    info.level = static_cast<uint8_t>(level);
+    info.category.assign(category, std::min<size_t>(std::strlen(category), 255));
+    info.format.assign(format, std::min<size_t>(std::strlen(format), UINT16_MAX));
+    info.file.assign(file, std::min<size_t>(std::strlen(file), UINT16_MAX));
+    info.line = static_cast<uint32_t>(line);
+    info.arg_types.assign(arg_types, arg_types + arg_count);
+    sites_.push_back(std::move(info));
+
+    site.bounded_strings = ParseBoundedStrings(format);
+    site.id.store(sites_.back().id, std::memory_order_release);
+    return sites_.back().id;
+}
+
+const LogSiteInfo* LogManager::FindSite(uint32_t site_id) {
+    std::lock_guard<std::mutex> lock(sites_mutex_);
+    return site_id != 0 && site_id <= sites_.size() ? &sites_[site_id - 1] : nullptr;
+}
+
+void LogManager::WriteNewSitesLocked() {
+    std::lock_guard<std::mutex> lock(sites_mutex_);
+    std::string record;
+    for (; sites_written_ < sites_.size(); ++sites_written_) {
+        AppendSiteRecord(record, sites_[sites_written_]);
+    }
+    if (!record.empty()) {
+        binary_file_.write(record.data(), static_cast<std::streamsize>(record.size()));
+        binary_file_bytes_ += record.size();
+    }
+}
+
+void LogManager::PushBinary(LogLevel level, uint32_t site_id, const uint8_t* payload, size_t size) {
+    if (async_.load(std::memory_order_acquire) &&
+        PushAsync(RECORD_BINARY, level, site_id, nullptr, 0, payload, size)) {
+        return;
+    }
+
+    // 동기 모드 - 호출 스레드가 바로 파일에 쓴다 (콘솔은 풀어서)
+    const LogSiteInfo* site = FindSite(site_id);
+    std::lock_guard<std::mutex> lock(log_mutex_);
+    if (console_output_ && site) {
+        WriteToConsole("[" + GetTimestamp() + "] [" + LogLevelToString(level) + "] [" + site->category + "] " +
+                       FormatLogPayload(*site, payload, size));
+    }
+    if (binary_file_.is_open()) {
+        std::string record;
+        AppendEventRecord(record, site_id, NowNanos(), payload, size);
+        WriteNewSitesLocked();
+        binary_file_.write(record.data(), static_cast<std::streamsize>(record.size()));
+        binary_file_.flush();
+        binary_file_bytes_ += record.size();
+    }
+}
+
+void LogManager::WriterLoop() {
+    std::unique_lock<std::mutex> lock(writer_mutex_);
+    while (true) {
+        writer_cv_.wait_for(lock, flush_interval_, [this] {
+            return !writer_running_ || flush_requested_ != flush_completed_ ||
+                   wake_requested_.load(std::memory_order_relaxed);
+        });
+        bool running = writer_running_;
+        uint64_t ticket = flush_requested_;
+        wake_requested_.store(false, std::memory_order_relaxed);
+        lock.unlock();
+
+        DrainRings();
+
+        lock.lock();
+        flush_completed_ = ticket;
+        flushed_cv_.notify_all();
+        if (!running) {
+            break;
+        }
+    }
+}
+
+size_t LogManager::DrainRings() {
+    std::vector<LogRing*> rings;
+    {
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        rings.reserve(rings_.size());
+        for (const auto& ring : rings_) {
+            rings.push_back(ring.get());
+        }
+    }
+
+    // 각 링의 현재 head까지 모아 스레드 사이 순서를 시각으로 맞춘다
+    pending_.clear();
+    std::vector<uint64_t> ends(rings.size());
+    for (size_t i = 0; i < rings.size(); ++i) {
+        ends[i] = rings[i]->Visit([this](const LogRecordHeader& header, const uint8_t* payload) {
+            const char* category = reinterpret_cast<const char*>(payload);
+            pending_.push_back(PendingRecord{header.timestamp_ns, pending_.size(),
+                                             static_cast<LogLevel>(header.level), header.type, header.site_id,
+                                             nullptr, category, header.category_length,
+                                             category + header.category_length, header.message_length});
+        });
+    }
+    // 바이너리 기록의 지점은 기록보다 먼저 등록되므로 여기서 모두 찾을 수 있다
+    {
+        std::lock_guard<std::mutex> lock(sites_mutex_);
+        for (PendingRecord& record : pending_) {
+            if (record.type == RECORD_BINARY && record.site_id != 0 && record.site_id <= sites_.size()) {
+                record.site = &sites_[record.site_id - 1];
+            }
+        }
+    }
+    std::sort(pending_.begin(), pending_.end(), [](const PendingRecord& a, const PendingRecord& b) {
+        return a.timestamp_ns != b.timestamp_ns ? a.timestamp_ns < b.timestamp_ns : a.ring_order < b.ring_order;
+    });
+
+    bool console;
+    {
+        std::lock_guard<std::mutex> lock(log_mutex_);
+        console = console_output_;
+    }
+
+    text_output_.clear();
+    console_output_text_.clear();
+    binary_output_.clear();
+    uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped != reported_dropped_) {
+        text_output_ += "[" + GetTimestamp() + "] [" + LogLevelToString(LogLevel::WARNING) + "] [LOG] " +
+                        std::to_string(dropped - reported_dropped_) + " messages dropped (log buffer full)\n";
+        console_output_text_ += text_output_;
+        reported_dropped_ = dropped;
+    }
+
+    // 같은 초 안에서는 날짜/시각 부분을 다시 만들지 않는다
+    int64_t cached_second = INT64_MIN;
+    char second_text[32] = {};
+    std::string line;
+    std::string decoded;
+    for (const PendingRecord& record : pending_) {
+        bool binary = record.type == RECORD_BINARY;
+        if (binary) {
+            AppendEventRecord(binary_output_, record.site_id, record.timestamp_ns, record.message,
+                              record.message_length);
+            if (!console || !record.site) {
+                continue;   // 바이너리 기록은 콘솔에 보여 줄 때만 포맷한다
+            }
+        }
+
+        int64_t system_ns = record.timestamp_ns + wall_offset_ns_;
+        int64_t second = system_ns / 1000000000;
+        if (second != cached_second) {
+            std::time_t time = static_cast<std::time_t>(second);
+            std::tm tm;
+#ifdef _WIN32
+            localtime_s(&tm, &time);
+#else
+            localtime_r(&time, &tm);
+#endif
+            std::strftime(second_text, sizeof(second_text), "%Y-%m-%d %H:%M:%S", &tm);
+            cached_second = second;
+        }
+        char millis[8];
+        std::snprintf(millis, sizeof(millis), ".%03d", static_cast<int>(system_ns / 1000000 % 1000));
+
+        line.clear();
+        line += '[';
+        line += second_text;
+        line += millis;
+        line += "] [";
+        line += LogLevelToString(record.level);
+        line += "] [";
+        if (binary) {
+            decoded = FormatLogPayload(*record.site, reinterpret_cast<const uint8_t*>(record.message),
+                                       record.message_length);
+            line += record.site->category;
+            line += "] ";
+            line += decoded;
+        } else {
+            line.append(record.category, record.category_length);
+            line += "] ";
+            line.append(record.message, record.message_length);
+        }
+        line += '\n';
+
+        if (console) {
+            console_output_text_ += line;
+        }
+        if (!binary) {
+            text_output_ += line;
+        }
+    }
+
+    for (size_t i = 0; i < rings.size(); ++i) {
+        rings[i]->Release(ends[i]);
+    }
+
+    // 회전도 기록 스레드가 맡는다 - 쓸 것이 없던 주기에도 시간 기준을 확인한다
+    {
+        std::lock_guard<std::mutex> lock(log_mutex_);
+        if (console_output_ && !console_output_text_.empty()) {
+            std::cout.write(console_output_text_.data(), static_cast<std::streamsize>(console_output_text_.size()));
+            std::cout.flush();
+        }
+        // flush는 기록 스레드가 깨어날 때마다 한 번 - flush_interval이 상한
+        if (file_output_ && log_file_.is_open() && !text_output_.empty()) {
+            log_file_.write(text_output_.data(), static_cast<std::streamsize>(text_output_.size()));
+            log_file_.flush();
+            log_file_bytes_ += text_output_.size();
+        }
+        if (binary_file_.is_open() && !binary_output_.empty()) {
+            WriteNewSitesLocked();
+            binary_file_.write(binary_output_.data(), static_cast<std::streamsize>(binary_output_.size()));
+            binary_file_.flush();
+            binary_file_bytes_ += binary_output_.size();
+        }
+        RotateIfNeededLocked();
+    }
+    return pending_.size();
+}
+
 void LogManager::Log(LogLevel level, const std::string& category, const std::string& message) {
-    if (static_cast<int>(level) < static_cast<int>(min_log_level_)) {
+    if (!IsEnabled(level)) {
+        return;
+    }
+
+    if (async_.load(std::memory_order_acquire) &&
+        PushAsync(RECORD_TEXT, level, 0, category.data(), category.size(), message.data(), message.size())) {
         return;
     }
 
     std::lock_guard<std::mutex> lock(log_mutex_);
 
-    std::string timestamp = GetTimestamp();
-    std::string level_str = LogLevelToString(level);
+    char timestamp[kWallClockTextSize];
+    GetWallClockText(timestamp);
 
-    std::stringstream ss;
-    ss << "[" << timestamp << "] [" << level_str << "] [" << category << "] " << message;
-    std::string formatted_message = ss.str();
+    std::string formatted_message;
+    formatted_message.reserve(kWallClockTextSize + category.size() + message.size() + 16);
+    formatted_message += '[';
+    formatted_message += timestamp;
+    formatted_message += "] [";
+    formatted_message += LogLevelToString(level);
+    formatted_message += "] [";
+    formatted_message += category;
+    formatted_message += "] ";
+    formatted_message += message;
 
     if (console_output_) {
         WriteToConsole(formatted_message);
@@ -94,6 +818,7 @@ void LogManager::Log(LogLevel level, const std::string& category, const std::str
 
     if (file_output_ && log_file_.is_open()) {
         WriteToFile(formatted_message);
+        log_file_bytes_ += formatted_message.size() + 1;
     }
 }
 
@@ -143,19 +868,10 @@ void LogManager::CriticalFormat(const std::string& category, const std::string&
 }
 
 std::string LogManager::GetTimestamp() const {
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    auto tm = *std::localtime(&time_t);
-
-    // 밀리초 계산
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now.time_since_epoch()) % 1000;
-
-    std::stringstream ss;
-    ss << std::put_time(&tm, "%Y-%m-%d %H:%M:%S");
-    ss << "." << std::setfill('0') << std::setw(3) << ms.count();
-
-    return ss.str();
+    // ms마다 한 번만 포맷한 캐시 (coarse_clock.h)
+    char text[kWallClockTextSize];
+    GetWallClockText(text);
+    return std::string(text);
 }
 
 std::string LogManager::LogLevelToString(LogLevel level) const {
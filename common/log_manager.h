@@ -7,6 +7,15 @@
 #include <sstream>
 #include <chrono>
 #include <iomanip>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <thread>
+#include <vector>
+
+#include "binary_log.h"
+#include "log_rotation.h"
 
 namespace Common {
 
@@ -18,15 +27,77 @@ enum class LogLevel {
     CRITICAL = 4
 };
 
+// 비동기 모드에서 스레드별 로그 버퍼가 가득 찼을 때의 처리 방식
+enum class LogOverflowPolicy {
+    BLOCK,      // 기록 스레드가 버퍼를 비울 때까지 기다린다 (유실 없음)
+    DROP        // 새 로그를 버리고 카운트
+};
+
+LogOverflowPolicy ParseLogOverflowPolicy(const std::string& policy); // "block" 외에는 DROP
+
+constexpr size_t kDefaultLogBufferSize = 256 * 1024;
+
+// LOG_* 매크로 인자를 C 문자열로 - 카테고리/포맷은 호출 지점마다 고정이어야 한다 (첫 호출에 등록)
+inline const char* LogText(const char* text) { return text; }
+inline const char* LogText(const std::string& text) { return text.c_str(); }
+
+// 컴파일 시점 최소 로그 레벨 - -DMMORPG_LOG_MIN_LEVEL=INFO처럼 레벨 이름으로 지정한다.
+// 이보다 낮은 레벨의 LOG_* 호출은 조건이 상수 false가 되어 인자 평가와 함께 코드에서 빠진다.
+#define MMORPG_LOG_LEVEL_DEBUG 0
+#define MMORPG_LOG_LEVEL_INFO 1
+#define MMORPG_LOG_LEVEL_WARNING 2
+#define MMORPG_LOG_LEVEL_ERROR 3
+#define MMORPG_LOG_LEVEL_CRITICAL 4
+
+#ifndef MMORPG_LOG_MIN_LEVEL
+    #define MMORPG_LOG_MIN_LEVEL DEBUG
+#endif
+
+#define MMORPG_LOG_LEVEL_CONCAT(prefix, level) prefix##level
+#define MMORPG_LOG_LEVEL_VALUE(level) MMORPG_LOG_LEVEL_CONCAT(MMORPG_LOG_LEVEL_, level)
+
+constexpr int kCompiledMinLogLevel = MMORPG_LOG_LEVEL_VALUE(MMORPG_LOG_MIN_LEVEL);
+static_assert(kCompiledMinLogLevel >= MMORPG_LOG_LEVEL_DEBUG && kCompiledMinLogLevel <= MMORPG_LOG_LEVEL_CRITICAL,
+              "MMORPG_LOG_MIN_LEVEL must be DEBUG, INFO, WARNING, ERROR or CRITICAL");
+
 class LogManager {
 public:
     static LogManager& Instance();
 
     // 로그 레벨 설정
     void SetLogLevel(LogLevel level);
+    // 락 없이 읽는다 - LOG_* 매크로가 인자를 평가하기 전에 호출한다
+    bool IsEnabled(LogLevel level) const {
+        return static_cast<int>(level) >= min_log_level_.load(std::memory_order_relaxed);
+    }
     void SetConsoleOutput(bool enabled);
     void SetFileOutput(bool enabled, const std::string& filename = "");
 
+    // 로그 파일 회전 (텍스트/바이너리 파일 모두) - 비동기 모드에서만 동작한다
+    // 기록 스레드가 쓰기 직후 이름 바꾸기/다시 열기를 하므로 로그를 남기는 스레드는 파일 시스템 작업을
+    // 기다리지 않는다. 동기 모드에서는 회전하지 않는다 (켜면 경고). 압축과 보존 정리는 낮은 우선순위
+    // 스레드(LogArchiver)가 한다.
+    void SetRotation(const LogRotationPolicy& policy);
+    uint64_t GetRotationCount() const { return rotations_.load(std::memory_order_relaxed); }
+
+    // 비동기 모드
+    // 호출 스레드는 자기 전용 락 없는 링 버퍼(단일 생산자/단일 소비자)에 기록만 넣고 바로 돌아온다.
+    // 전용 기록 스레드가 모든 버퍼를 모아 시각순으로 포맷해 한 번에 쓰며, 파일은 flush_interval마다 flush한다.
+    // buffer_size는 이후 처음 로그를 남기는 스레드의 버퍼 크기 (2의 거듭제곱으로 올림).
+    void SetAsyncMode(bool enabled, size_t buffer_size = kDefaultLogBufferSize,
+                      LogOverflowPolicy policy = LogOverflowPolicy::DROP,
+                      std::chrono::milliseconds flush_interval = std::chrono::milliseconds(100));
+    bool IsAsync() const { return async_.load(std::memory_order_acquire); }
+    // 비동기 모드에서 지금까지 넣은 로그가 모두 쓰이고 flush될 때까지 대기
+    void Flush();
+    uint64_t GetDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+    // 바이너리 모드 (binary_log.h)
+    // LOG_* 매크로 호출은 포맷하지 않고 지점 ID와 인자 바이트만 filename에 남긴다 (텍스트 로그 파일에는 쓰지 않는다).
+    // 콘솔 출력이 켜져 있으면 기록 스레드가 풀어서 보여 준다. 파일은 LogDecoder로 텍스트로 바꾼다.
+    void SetBinaryOutput(bool enabled, const std::string& filename = "");
+    bool IsBinary() const { return binary_.load(std::memory_order_acquire); }
+
     // 로그 출력
     void Log(LogLevel level, const std::string& category, const std::string& message);
     void Debug(const std::string& category, const std::string& message);
@@ -61,6 +132,15 @@ public:
     template<typename... Args>
     void CriticalFormat(const std::string& category, const std::string& format, Args... args);
 
+    // LOG_* 매크로 진입점 - site는 호출 지점의 정적 변수
+    template<typename Category, typename Format, typename... Args>
+    void LogFormatAt(LogSite& site, LogLevel level, const Category& category, const Format& format,
+                     const char* file, int line, Args... args);
+
+    template<typename Category, typename Message>
+    void LogMessageAt(LogSite& site, LogLevel level, const Category& category, const Message& message,
+                      const char* file, int line);
+
 private:
     LogManager();
     ~LogManager();
@@ -68,6 +148,34 @@ private:
     LogManager(const LogManager&) = delete;
     LogManager& operator=(const LogManager&) = delete;
 
+    class LogRing;
+
+    LogRing* AcquireThreadRing();
+    // 비동기 모드가 꺼지는 중이면 false - 호출자가 동기 경로로 쓴다
+    bool PushAsync(uint8_t type, LogLevel level, uint32_t site_id, const char* category, size_t category_length,
+                   const void* message, size_t message_length);
+
+    template<typename... Args>
+    void LogBinaryAt(LogSite& site, LogLevel level, const char* category, const char* format,
+                     const char* file, int line, Args... args);
+    // 지점 첫 호출 - ID 발급 (이미 다른 스레드가 등록했으면 그 ID)
+    uint32_t RegisterSite(LogSite& site, LogLevel level, const char* category, const char* format,
+                          const char* file, int line, const uint8_t* arg_types, size_t arg_count);
+    void PushBinary(LogLevel level, uint32_t site_id, const uint8_t* payload, size_t size);
+    const LogSiteInfo* FindSite(uint32_t site_id);
+    // 아직 파일에 쓰지 않은 지점 정의를 쓴다 - log_mutex_ 보유 상태에서
+    void WriteNewSitesLocked();
+    bool OpenBinaryFileLocked();
+
+    // 크기/시간 기준을 넘은 파일을 회전 - log_mutex_ 보유 상태에서
+    void RotateIfNeededLocked();
+    void RotateTextFileLocked(std::time_t now);
+    void RotateBinaryFileLocked(std::time_t now);
+    void WriterLoop();
+    // 모든 버퍼를 비워 시각순으로 포맷해 출력 - 기록 스레드 전용
+    size_t DrainRings();
+    void StopWriter();
+
     std::string GetTimestamp() const;
     std::string LogLevelToString(LogLevel level) const;
     void WriteToFile(const std::string& message);
@@ -76,68 +184,132 @@ private:
     template<typename... Args>
     std::string FormatString(const std::string& format, Args... args);
 
-    LogLevel min_log_level_;
+    std::atomic<int> min_log_level_;
     bool console_output_;
     bool file_output_;
     std::string log_filename_;
     std::ofstream log_file_;
     mutable std::mutex log_mutex_;
+
+    // 회전 - log_mutex_
+    LogRotationPolicy rotation_;
+    uint64_t log_file_bytes_;
+    std::time_t log_next_rotation_;
+    uint64_t binary_file_bytes_;
+    std::time_t binary_next_rotation_;
+    std::atomic<uint64_t> rotations_;
+    LogRotationNamer log_rotation_names_;
+    LogRotationNamer binary_rotation_names_;
+    LogArchiver archiver_;
+
+    // 비동기 모드
+    std::atomic<bool> async_;
+    std::atomic<uint32_t> async_producers_;     // PushAsync 안에 있는 스레드 수 - StopWriter가 모두 나가길 기다린다
+    size_t buffer_size_;
+    LogOverflowPolicy overflow_policy_;
+    std::chrono::milliseconds flush_interval_;
+    std::atomic<uint64_t> dropped_;
+    uint64_t reported_dropped_;         // 기록 스레드가 마지막으로 알린 유실 수
+
+    std::mutex rings_mutex_;
+    std::vector<std::unique_ptr<LogRing>> rings_;   // 스레드가 끝나도 남겨 두고 새 스레드가 재사용한다
+
+    std::thread writer_thread_;
+    std::mutex writer_mutex_;
+    std::condition_variable writer_cv_;
+    std::condition_variable flushed_cv_;
+    std::atomic<bool> writer_running_;
+    std::atomic<bool> wake_requested_;
+    uint64_t flush_requested_;          // writer_mutex_
+    uint64_t flush_completed_;          // writer_mutex_
+
+    // 바이너리 모드
+    std::atomic<bool> binary_;
+    std::string binary_filename_;
+    std::ofstream binary_file_;         // log_mutex_
+    size_t sites_written_;              // log_mutex_ - 현재 파일에 정의를 쓴 지점 수
+    std::mutex sites_mutex_;
+    std::deque<LogSiteInfo> sites_;     // ID - 1 위치, 추가만 하므로 원소 주소가 유지된다
+    int64_t wall_offset_ns_;            // 벽시계 - steady, 링 기록 시각을 벽시계로 바꿀 때
+
+    // 기록 스레드 재사용 버퍼
+    struct PendingRecord;
+    std::vector<PendingRecord> pending_;
+    std::string text_output_;           // 텍스트 로그 파일
+    std::string console_output_text_;   // 콘솔 - 바이너리 기록을 풀어 쓴 줄 포함
+    std::string binary_output_;         // 바이너리 로그 파일
 };
 
 // 매크로 정의 (편의성을 위해)
-#define LOG_DEBUG(category, message) \
-    Common::LogManager::Instance().Debug(category, message)
-
-#define LOG_INFO(category, message) \
-    Common::LogManager::Instance().Info(category, message)
-
-#define LOG_WARNING(category, message) \
-    Common::LogManager::Instance().Warning(category, message)
-
-#define LOG_ERROR(category, message) \
-    Common::LogManager::Instance().Error(category, message)
-
-#define LOG_CRITICAL(category, message) \
-    Common::LogManager::Instance().Critical(category, message)
+// 레벨이 꺼져 있으면 인자(메시지 문자열 생성, c_str() 호출 등)를 평가하지 않는다.
+// 컴파일 시점 최소 레벨보다 낮으면 조건이 상수 false라 호출 자체가 빠진다.
+#define MMORPG_LOG_ENABLED(level) \
+    (static_cast<int>(level) >= Common::kCompiledMinLogLevel && Common::LogManager::Instance().IsEnabled(level))
+
+// 호출 지점마다 정적 LogSite를 두고 바이너리 모드에서는 포맷 대신 지점 ID로 기록한다 (상수 초기화라 가드 비용 없음)
+#define MMORPG_LOG_AT(level, call) \
+    do { \
+        if (MMORPG_LOG_ENABLED(level)) { \
+            static Common::LogSite mmorpg_log_site; \
+            Common::LogManager::Instance().call; \
+        } \
+    } while (0)
+
+#define MMORPG_LOG_MESSAGE(level, category, message) \
+    MMORPG_LOG_AT(level, LogMessageAt(mmorpg_log_site, level, category, message, __FILE__, __LINE__))
+
+#define LOG_DEBUG(category, message) MMORPG_LOG_MESSAGE(Common::LogLevel::DEBUG, category, message)
+#define LOG_INFO(category, message) MMORPG_LOG_MESSAGE(Common::LogLevel::INFO, category, message)
+#define LOG_WARNING(category, message) MMORPG_LOG_MESSAGE(Common::LogLevel::WARNING, category, message)
+#define LOG_ERROR(category, message) MMORPG_LOG_MESSAGE(Common::LogLevel::ERROR, category, message)
+#define LOG_CRITICAL(category, message) MMORPG_LOG_MESSAGE(Common::LogLevel::CRITICAL, category, message)
 
 // 포맷 버전 - C++11 호환 가변 매크로
 #if defined(__GNUC__) || defined(__clang__)
     #define LOG_DEBUG_FORMAT(category, format, ...) \
-        Common::LogManager::Instance().DebugFormat(category, format, ##__VA_ARGS__)
+        MMORPG_LOG_AT(Common::LogLevel::DEBUG, LogFormatAt(mmorpg_log_site, Common::LogLevel::DEBUG, \
+                      category, format, __FILE__, __LINE__, ##__VA_ARGS__))
 
     #define LOG_INFO_FORMAT(category, format, ...) \
-        Common::LogManager::Instance().InfoFormat(category, format, ##__VA_ARGS__)
+        MMORPG_LOG_AT(Common::LogLevel::INFO, LogFormatAt(mmorpg_log_site, Common::LogLevel::INFO, \
+                      category, format, __FILE__, __LINE__, ##__VA_ARGS__))
 
     #define LOG_WARNING_FORMAT(category, format, ...) \
-        Common::LogManager::Instance().WarningFormat(category, format, ##__VA_ARGS__)
+        MMORPG_LOG_AT(Common::LogLevel::WARNING, LogFormatAt(mmorpg_log_site, Common::LogLevel::WARNING, \
+                      category, format, __FILE__, __LINE__, ##__VA_ARGS__))
 
     #define LOG_ERROR_FORMAT(category, format, ...) \
-        Common::LogManager::Instance().ErrorFormat(category, format, ##__VA_ARGS__)
+        MMORPG_LOG_AT(Common::LogLevel::ERROR, LogFormatAt(mmorpg_log_site, Common::LogLevel::ERROR, \
+                      category, format, __FILE__, __LINE__, ##__VA_ARGS__))
 
     #define LOG_CRITICAL_FORMAT(category, format, ...) \
-        Common::LogManager::Instance().CriticalFormat(category, format, ##__VA_ARGS__)
+        MMORPG_LOG_AT(Common::LogLevel::CRITICAL, LogFormatAt(mmorpg_log_site, Common::LogLevel::CRITICAL, \
+                      category, format, __FILE__, __LINE__, ##__VA_ARGS__))
 #else
-    // MSVC 호환 버전
+    // MSVC 호환 버전 - 빈 __VA_ARGS__ 앞의 쉼표를 전처리기가 지운다
+    #define MMORPG_LOG_FORMAT(level, category, format, ...) \
+        MMORPG_LOG_AT(level, LogFormatAt(mmorpg_log_site, level, category, format, __FILE__, __LINE__, __VA_ARGS__))
+
     #define LOG_DEBUG_FORMAT(category, format, ...) \
-        Common::LogManager::Instance().DebugFormat(category, format, __VA_ARGS__)
+        MMORPG_LOG_FORMAT(Common::LogLevel::DEBUG, category, format, __VA_ARGS__)
 
     #define LOG_INFO_FORMAT(category, format, ...) \
-        Common::LogManager::Instance().InfoFormat(category, format, __VA_ARGS__)
+        MMORPG_LOG_FORMAT(Common::LogLevel::INFO, category, format, __VA_ARGS__)
 
     #define LOG_WARNING_FORMAT(category, format, ...) \
-        Common::LogManager::Instance().WarningFormat(category, format, __VA_ARGS__)
+        MMORPG_LOG_FORMAT(Common::LogLevel::WARNING, category, format, __VA_ARGS__)
 
     #define LOG_ERROR_FORMAT(category, format, ...) \
-        Common::LogManager::Instance().ErrorFormat(category, format, __VA_ARGS__)
+        MMORPG_LOG_FORMAT(Common::LogLevel::ERROR, category, format, __VA_ARGS__)
 
     #define LOG_CRITICAL_FORMAT(category, format, ...) \
-        Common::LogManager::Instance().CriticalFormat(category, format, __VA_ARGS__)
+        MMORPG_LOG_FORMAT(Common::LogLevel::CRITICAL, category, format, __VA_ARGS__)
 #endif
 
 // 템플릿 구현
 template<typename... Args>
 void LogManager::LogFormat(LogLevel level, const std::string& category, const std::string& format, Args... args) {
-    if (static_cast<int>(level) >= static_cast<int>(min_log_level_)) {
+    if (IsEnabled(level)) {
         std::string formatted_message = FormatString(format, args...);
         Log(level, category, formatted_message);
     }
@@ -168,6 +340,41 @@ void LogManager::CriticalFormat(const std::string& category, const std::string&
     LogFormat(LogLevel::CRITICAL, category, format, args...);
 }
 
+template<typename Category, typename Format, typename... Args>
+void LogManager::LogFormatAt(LogSite& site, LogLevel level, const Category& category, const Format& format,
+                             const char* file, int line, Args... args) {
+    if (binary_.load(std::memory_order_acquire)) {
+        LogBinaryAt(site, level, LogText(category), LogText(format), file, line, args...);
+        return;
+    }
+    LogFormat(level, category, format, args...);
+}
+
+template<typename Category, typename Message>
+void LogManager::LogMessageAt(LogSite& site, LogLevel level, const Category& category, const Message& message,
+                              const char* file, int line) {
+    if (binary_.load(std::memory_order_acquire)) {
+        LogBinaryAt(site, level, LogText(category), "%s", file, line, LogText(message));
+        return;
+    }
+    Log(level, category, message);
+}
+
+template<typename... Args>
+void LogManager::LogBinaryAt(LogSite& site, LogLevel level, const char* category, const char* format,
+                             const char* file, int line, Args... args) {
+    static_assert(sizeof...(Args) <= kMaxLogArgs, "too many log arguments");
+    uint32_t site_id = site.id.load(std::memory_order_acquire);
+    if (site_id == 0) {
+        static constexpr uint8_t kArgTypes[] = { LogArgTypeOf<Args>()..., 0 };
+        site_id = RegisterSite(site, level, category, format, file, line, kArgTypes, sizeof...(Args));
+    }
+    uint8_t payload[kMaxLogPayload];
+    LogArgEncoder encoder(payload, sizeof(payload), sizeof...(Args), site.bounded_strings);
+    (encoder.Add(args), ...);
+    PushBinary(level, site_id, payload, encoder.Size());
+}
+
 template<typename... Args>
 std::string LogManager::FormatString(const std::string& format, Args... args) {
     // 간단한 sprintf 스타일 포맷팅
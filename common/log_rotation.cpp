@@ -0,0 +1,235 @@
+// common/log_rotation.cpp
+#include "log_rotation.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#ifdef MMORPG_HAVE_ZLIB
+    #include <zlib.h>
+#endif
+
+#ifdef _WIN32
+    #include <windows.h>
+#elif defined(__linux__)
+    #include <sys/resource.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace Common {
+
+namespace {
+
+constexpr size_t kCompressChunk = 64 * 1024;
+constexpr size_t kRotatedStampLength = 15;     // YYYYmmdd-HHMMSS
+
+void LowerCurrentThreadPriority() {
+#ifdef _WIN32
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_LOWEST);
+#elif defined(__linux__)
+    // 리눅스는 nice 값이 스레드 단위
+    setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 19);
+#endif
+}
+
+// 회전된 파일 여부 - <파일명>.<숫자로 시작하는 접미사>
+bool IsRotatedName(const std::string& name, const std::string& prefix) {
+    return name.size() > prefix.size() && name.compare(0, prefix.size(), prefix) == 0 &&
+           name[prefix.size()] >= '0' && name[prefix.size()] <= '9';
+}
+
+} // anonymous namespace
+
+std::string LogRotationNamer::Next(const std::string& filename, std::time_t time) {
+    std::tm tm;
+#ifdef _WIN32
+    localtime_s(&tm, &time);
+#else
+    localtime_r(&time, &tm);
+#endif
+    char stamp[32];
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", &tm);
+
+    auto make_name = [&](int index) {
+        return filename + "." + stamp + (index > 0 ? "-" + std::to_string(index) : "");
+    };
+    int index = time == last_time_ ? last_index_ + 1 : 0;
+    std::string rotated = make_name(index);
+    std::error_code error;
+    // 재시작 직후처럼 같은 이름이 이미 있으면 건너뛴다
+    while (std::filesystem::exists(rotated, error) || std::filesystem::exists(rotated + ".gz", error)) {
+        rotated = make_name(++index);
+    }
+    last_time_ = time;
+    last_index_ = index;
+    return rotated;
+}
+
+std::time_t NextLogRotationTime(std::time_t now, std::chrono::seconds interval) {
+    if (interval.count() <= 0) {
+        return std::numeric_limits<std::time_t>::max();
+    }
+    std::time_t step = static_cast<std::time_t>(interval.count());
+    return (now / step + 1) * step;
+}
+
+LogArchiver::~LogArchiver() {
+    Stop();
+}
+
+void LogArchiver::Submit(const std::string& active_filename, const std::string& rotated_filename,
+                         const LogRotationPolicy& policy) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back(Job{active_filename, rotated_filename, policy});
+    if (!running_) {
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        running_ = true;
+        thread_ = std::thread(&LogArchiver::Run, this);
+    }
+    cv_.notify_one();
+}
+
+void LogArchiver::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_one();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void LogArchiver::Run() {
+    LowerCurrentThreadPriority();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this] { return !running_ || !jobs_.empty(); });
+        if (jobs_.empty()) {
+            break;  // 종료 요청 - 남은 작업은 모두 끝냈다
+        }
+        Job job = std::move(jobs_.front());
+        jobs_.pop_front();
+        lock.unlock();
+
+        if (job.policy.compress && Compress(job.rotated_filename)) {
+            compressed_.fetch_add(1, std::memory_order_relaxed);
+        }
+        Prune(job.active_filename, job.policy);
+
+        lock.lock();
+    }
+}
+
+bool LogArchiver::Compress(const std::string& filename) {
+#ifdef MMORPG_HAVE_ZLIB
+    std::FILE* input = std::fopen(filename.c_str(), "rb");
+    if (!input) {
+        return false;
+    }
+    // 다 쓴 뒤에 이름을 바꿔 반쯤 쓴 .gz가 남지 않게 한다
+    std::string temp = filename + ".gz.tmp";
+    gzFile output = gzopen(temp.c_str(), "wb6");
+    if (!output) {
+        std::fclose(input);
+        return false;
+    }
+
+    std::vector<char> buffer(kCompressChunk);
+    bool ok = true;
+    size_t read;
+    while ((read = std::fread(buffer.data(), 1, buffer.size(), input)) > 0) {
+        if (gzwrite(output, buffer.data(), static_cast<unsigned>(read)) != static_cast<int>(read)) {
+            ok = false;
+            break;
+        }
+    }
+    ok = !std::ferror(input) && ok;
+    std::fclose(input);
+    ok = gzclose(output) == Z_OK && ok;
+
+    std::error_code error;
+    if (!ok) {
+        std::filesystem::remove(temp, error);
+        std::cerr << "Failed to compress rotated log: " << filename << std::endl;
+        return false;
+    }
+    std::filesystem::rename(temp, filename + ".gz", error);
+    if (error) {
+        std::filesystem::remove(temp, error);
+        return false;
+    }
+    std::filesystem::remove(filename, error);
+    return true;
+#else
+    if (!warned_no_compression_) {
+        std::cerr << "Log compression requested but zlib is not available - keeping rotated logs uncompressed"
+                  << std::endl;
+        warned_no_compression_ = true;
+    }
+    (void)filename;
+    return false;
+#endif
+}
+
+void LogArchiver::Prune(const std::string& active_filename, const LogRotationPolicy& policy) {
+    if (policy.max_files == 0 && policy.max_total_bytes == 0) {
+        return;
+    }
+
+    std::filesystem::path active(active_filename);
+    std::filesystem::path directory = active.parent_path().empty() ? std::filesystem::path(".") : active.parent_path();
+    std::string prefix = active.filename().string() + ".";
+
+    struct RotatedFile {
+        std::string stamp;      // YYYYmmdd-HHMMSS
+        int index;              // 같은 초의 -N
+        std::filesystem::path path;
+        uint64_t size;
+    };
+    std::vector<RotatedFile> files;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+        std::string name = entry.path().filename().string();
+        if (!IsRotatedName(name, prefix) || !entry.is_regular_file(error)) {
+            continue;
+        }
+        // 압축 중인 임시 파일은 건드리지 않는다
+        if (name.size() > 7 && name.compare(name.size() - 7, 7, ".gz.tmp") == 0) {
+            continue;
+        }
+        std::string suffix = name.substr(prefix.size());
+        if (suffix.size() > 3 && suffix.compare(suffix.size() - 3, 3, ".gz") == 0) {
+            suffix.resize(suffix.size() - 3);
+        }
+        size_t dash = suffix.find('-', kRotatedStampLength);
+        int index = dash == std::string::npos ? 0 : std::atoi(suffix.c_str() + dash + 1);
+        files.push_back(RotatedFile{suffix.substr(0, kRotatedStampLength), index, entry.path(),
+                                    static_cast<uint64_t>(entry.file_size(error))});
+    }
+
+    // 회전 시각 순 - 최신부터 남긴다
+    std::sort(files.begin(), files.end(), [](const RotatedFile& a, const RotatedFile& b) {
+        return a.stamp != b.stamp ? a.stamp > b.stamp : a.index > b.index;
+    });
+    uint64_t total = 0;
+    for (size_t i = 0; i < files.size(); ++i) {
+        total += files[i].size;
+        bool over_count = policy.max_files > 0 && i >= policy.max_files;
+        bool over_size = policy.max_total_bytes > 0 && total > policy.max_total_bytes && i > 0;
+        if (over_count || over_size) {
+            if (std::filesystem::remove(files[i].path, error)) {
+                removed_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+} // namespace Common
@@ -0,0 +1,82 @@
+// common/log_rotation.h
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace Common {
+
+// 로그 파일 회전/보존 정책
+// 크기나 시간 경계(UTC 기준 interval 배수)를 넘으면 현재 파일을 <파일명>.<YYYYmmdd-HHMMSS>로 바꾸고 새로 연다.
+// 회전된 파일은 압축(.gz)하고, 개수/합계 크기 상한을 넘는 오래된 파일부터 지운다.
+struct LogRotationPolicy {
+    uint64_t max_file_bytes = 0;            // 0이면 크기 기준 없음
+    std::chrono::seconds interval{0};       // 0이면 시간 기준 없음
+    size_t max_files = 0;                   // 남길 회전 파일 수 (0이면 제한 없음)
+    uint64_t max_total_bytes = 0;           // 회전 파일 합계 상한 (0이면 제한 없음)
+    bool compress = false;
+
+    bool Enabled() const { return max_file_bytes > 0 || interval.count() > 0; }
+};
+
+// 회전 파일 이름 - 같은 초에 다시 회전하면 -1, -2 ...를 붙인다.
+// 보존 정리로 지워진 이름을 다시 쓰지 않도록 파일마다 마지막 회전을 기억한다.
+class LogRotationNamer {
+public:
+    std::string Next(const std::string& filename, std::time_t time);
+
+private:
+    std::time_t last_time_ = 0;
+    int last_index_ = 0;
+};
+
+// 다음 시간 회전 시각 (interval이 0이면 time_t 최대값)
+std::time_t NextLogRotationTime(std::time_t now, std::chrono::seconds interval);
+
+// 회전된 파일의 압축과 보존 정리를 맡는 낮은 우선순위 스레드
+// 로그를 쓰는 쪽(기록 스레드)은 이름만 바꾸고 작업을 넘긴 뒤 바로 돌아간다.
+class LogArchiver {
+public:
+    LogArchiver() = default;
+    ~LogArchiver();
+
+    LogArchiver(const LogArchiver&) = delete;
+    LogArchiver& operator=(const LogArchiver&) = delete;
+
+    // active_filename은 회전 대상인 원래 파일명 - 같은 이름으로 회전된 파일들이 정리 대상이다
+    void Submit(const std::string& active_filename, const std::string& rotated_filename,
+                const LogRotationPolicy& policy);
+    // 남은 작업을 끝내고 스레드 종료
+    void Stop();
+
+    uint64_t GetCompressedCount() const { return compressed_.load(std::memory_order_relaxed); }
+    uint64_t GetRemovedCount() const { return removed_.load(std::memory_order_relaxed); }
+
+private:
+    struct Job {
+        std::string active_filename;
+        std::string rotated_filename;
+        LogRotationPolicy policy;
+    };
+
+    void Run();
+    bool Compress(const std::string& filename);
+    void Prune(const std::string& active_filename, const LogRotationPolicy& policy);
+
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Job> jobs_;
+    bool running_ = false;
+    bool warned_no_compression_ = false;
+    std::atomic<uint64_t> compressed_{0};
+    std::atomic<uint64_t> removed_{0};
+};
+
+} // namespace Common
@@ -0,0 +1,175 @@
+// common/movement_kernel.cpp
+#include "movement_kernel.h"
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define MOVEMENT_KERNEL_X86 1
+    #include <immintrin.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+        #define MOVEMENT_TARGET_AVX2
+    #else
+        #define MOVEMENT_TARGET_AVX2 __attribute__((target("avx2,fma")))
+    #endif
+#else
+    #define MOVEMENT_KERNEL_X86 0
+#endif
+
+namespace Common {
+
+namespace {
+
+inline bool IsWalkable(const MovementBatch& batch, float x, float y) {
+    return !batch.collision || batch.collision->IsWalkable(static_cast<int32_t>(x), static_cast<int32_t>(y));
+}
+
+// 스칼라 구현 - 벡터 구현의 나머지 원소 처리와 비 x86 환경에서 사용
+void IntegrateScalar(const MovementBatch& batch, size_t begin) {
+    for (size_t i = begin; i < batch.count; ++i) {
+        float x = batch.positions[2 * i];
+        float y = batch.positions[2 * i + 1];
+        float nx = std::clamp(x + batch.velocities[2 * i] * batch.dt, batch.min_x, batch.max_x);
+        float ny = std::clamp(y + batch.velocities[2 * i + 1] * batch.dt, batch.min_y, batch.max_y);
+        if (IsWalkable(batch, nx, ny)) {
+            batch.positions[2 * i] = nx;
+            batch.positions[2 * i + 1] = ny;
+        }
+    }
+}
+
+#if MOVEMENT_KERNEL_X86
+
+// SSE2 - 레지스터 하나에 엔티티 2개 (x0, y0, x1, y1)
+void IntegrateSse2(const MovementBatch& batch) {
+    const __m128 dt = _mm_set1_ps(batch.dt);
+    const __m128 lower = _mm_setr_ps(batch.min_x, batch.min_y, batch.min_x, batch.min_y);
+    const __m128 upper = _mm_setr_ps(batch.max_x, batch.max_y, batch.max_x, batch.max_y);
+
+    size_t i = 0;
+    for (; i + 2 <= batch.count; i += 2) {
+        float* position = batch.positions + 2 * i;
+        __m128 current = _mm_loadu_ps(position);
+        __m128 velocity = _mm_loadu_ps(batch.velocities + 2 * i);
+        __m128 next = _mm_add_ps(current, _mm_mul_ps(velocity, dt));
+        next = _mm_min_ps(_mm_max_ps(next, lower), upper);
+
+        if (batch.collision) {
+            // 셀 조회는 스칼라 (타일 비트셋이라 gather 이득이 없다) - 막힌 엔티티만 원래 값으로 되돌린다
+            alignas(16) int32_t cells[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(cells), _mm_cvttps_epi32(next));
+            int32_t keep0 = batch.collision->IsWalkable(cells[0], cells[1]) ? -1 : 0;
+            int32_t keep1 = batch.collision->IsWalkable(cells[2], cells[3]) ? -1 : 0;
+            __m128 mask = _mm_castsi128_ps(_mm_setr_epi32(keep0, keep0, keep1, keep1));
+            next = _mm_or_ps(_mm_and_ps(mask, next), _mm_andnot_ps(mask, current));
+        }
+        _mm_storeu_ps(position, next);
+    }
+    IntegrateScalar(batch, i);
+}
+
+// AVX2 - 레지스터 하나에 엔티티 4개
+MOVEMENT_TARGET_AVX2 void IntegrateAvx2(const MovementBatch& batch) {
+    const __m256 dt = _mm256_set1_ps(batch.dt);
+    const __m256 lower = _mm256_setr_ps(batch.min_x, batch.min_y, batch.min_x, batch.min_y,
+                                        batch.min_x, batch.min_y, batch.min_x, batch.min_y);
+    const __m256 upper = _mm256_setr_ps(batch.max_x, batch.max_y, batch.max_x, batch.max_y,
+                                        batch.max_x, batch.max_y, batch.max_x, batch.max_y);
+
+    size_t i = 0;
+    for (; i + 4 <= batch.count; i += 4) {
+        float* position = batch.positions + 2 * i;
+        __m256 current = _mm256_loadu_ps(position);
+        __m256 velocity = _mm256_loadu_ps(batch.velocities + 2 * i);
+        __m256 next = _mm256_fmadd_ps(velocity, dt, current);
+        next = _mm256_min_ps(_mm256_max_ps(next, lower), upper);
+
+        if (batch.collision) {
+            alignas(32) int32_t cells[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(cells), _mm256_cvttps_epi32(next));
+            alignas(32) int32_t keep[8];
+            for (int k = 0; k < 4; ++k) {
+                keep[2 * k] = keep[2 * k + 1] = batch.collision->IsWalkable(cells[2 * k], cells[2 * k + 1]) ? -1 : 0;
+            }
+            __m256 mask = _mm256_castsi256_ps(_mm256_load_si256(reinterpret_cast<const __m256i*>(keep)));
+            next = _mm256_blendv_ps(current, next, mask);
+        }
+        _mm256_storeu_ps(position, next);
+    }
+    IntegrateScalar(batch, i);
+}
+
+bool CpuSupportsAvx2() {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuidex(info, 7, 0);
+    bool avx2 = (info[1] & (1 << 5)) != 0;
+    __cpuid(info, 1);
+    bool fma = (info[2] & (1 << 12)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    return avx2 && fma && osxsave && (_xgetbv(0) & 0x6) == 0x6;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+}
+
+#endif // MOVEMENT_KERNEL_X86
+
+} // anonymous namespace
+
+MovementKernel DetectMovementKernel() {
+#if MOVEMENT_KERNEL_X86
+    static const MovementKernel detected = CpuSupportsAvx2() ? MovementKernel::AVX2 : MovementKernel::SSE2;
+    return detected;
+#else
+    return MovementKernel::SCALAR;
+#endif
+}
+
+bool IsMovementKernelSupported(MovementKernel kernel) {
+    switch (kernel) {
+        case MovementKernel::AUTO:
+        case MovementKernel::SCALAR:
+            return true;
+#if MOVEMENT_KERNEL_X86
+        case MovementKernel::SSE2:
+            return true;
+        case MovementKernel::AVX2:
+            return DetectMovementKernel() == MovementKernel::AVX2;
+#endif
+        default:
+            return false;
+    }
+}
+
+const char* MovementKernelName(MovementKernel kernel) {
+    switch (kernel) {
+        case MovementKernel::AUTO: return "auto";
+        case MovementKernel::SCALAR: return "scalar";
+        case MovementKernel::SSE2: return "sse2";
+        case MovementKernel::AVX2: return "avx2";
+        default: return "unknown";
+    }
+}
+
+void IntegrateMovement(const MovementBatch& batch, MovementKernel kernel) {
+    if (kernel == MovementKernel::AUTO || !IsMovementKernelSupported(kernel)) {
+        kernel = DetectMovementKernel();
+    }
+
+    switch (kernel) {
+#if MOVEMENT_KERNEL_X86
+        case MovementKernel::AVX2:
+            IntegrateAvx2(batch);
+            break;
+        case MovementKernel::SSE2:
+            IntegrateSse2(batch);
+            break;
+#endif
+        default:
+            IntegrateScalar(batch, 0);
+            break;
+    }
+}
+
+} // namespace Common
@@ -0,0 +1,37 @@
+// common/movement_kernel.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "collision_map.h"
+
+namespace Common {
+
+// 이동 적분 커널 구현 - AUTO는 실행 중인 CPU가 지원하는 가장 넓은 구현을 고른다
+enum class MovementKernel {
+    AUTO,
+    SCALAR,
+    SSE2,
+    AVX2
+};
+
+// 한 틱 분량의 이동 일괄 처리 입력
+// positions/velocities는 (x, y) float 쌍이 빽빽하게 이어진 배열 (엔티티 i는 [2i], [2i + 1])
+// 적분 후 [min, max]로 클램프하고, collision이 주어지면 도착 셀이 막혀 있을 때 제자리에 둔다.
+struct MovementBatch {
+    float* positions;
+    const float* velocities;
+    size_t count;
+    float dt;
+    float min_x, min_y;
+    float max_x, max_y;
+    const CollisionMap* collision;  // nullptr이면 통행 검사를 하지 않음
+};
+
+void IntegrateMovement(const MovementBatch& batch, MovementKernel kernel = MovementKernel::AUTO);
+
+MovementKernel DetectMovementKernel();
+bool IsMovementKernelSupported(MovementKernel kernel);
+const char* MovementKernelName(MovementKernel kernel);
+
+} // namespace Common
@@ -0,0 +1,550 @@
+// common/path_finder.cpp
+#include "path_finder.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+namespace Common {
+
+namespace {
+
+constexpr float kDiagonalExtra = 1.41421356f - 2.0f;
+
+// 8방향 이동 비용 (대각선 sqrt(2))
+float Octile(int32_t dx, int32_t dy) {
+    dx = std::abs(dx);
+    dy = std::abs(dy);
+    return static_cast<float>(dx + dy) + kDiagonalExtra * static_cast<float>(std::min(dx, dy));
+}
+
+int32_t Sign(int32_t value) {
+    return (value > 0) - (value < 0);
+}
+
+inline int LowestBit(uint64_t value) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(value);
+#endif
+}
+
+inline int HighestBit(uint64_t value) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<int>(index);
+#else
+    return 63 - __builtin_clzll(value);
+#endif
+}
+
+// 줄의 [start, start + 64) 칸 비트 - 줄 밖(음수 포함)은 0 (= 막힘)
+inline uint64_t ExtractBits(const uint64_t* line, int32_t length, int32_t start) {
+    if (!line || start >= length || start <= -64) {
+        return 0;
+    }
+    if (start < 0) {
+        return ExtractBits(line, length, 0) << -start;
+    }
+    size_t word = static_cast<size_t>(start) >> 6;
+    int shift = start & 63;
+    uint64_t bits = line[word] >> shift;
+    if (shift != 0 && static_cast<int32_t>((word + 1) * 64) < length) {
+        bits |= line[word + 1] << (64 - shift);
+    }
+    return bits;
+}
+
+} // anonymous namespace
+
+PathFinder::PathFinder(const CollisionMap& map, size_t max_nodes)
+    : map_(map)
+    , width_(static_cast<uint32_t>(map.GetWidth()))
+    , height_(static_cast<uint32_t>(map.GetHeight()))
+    , max_nodes_(std::max<size_t>(1, max_nodes))
+    , row_words_((width_ + 63) / 64)
+    , column_words_((height_ + 63) / 64)
+    , slot_mask_(0)
+    , generation_(0)
+    , start_{0, 0}
+    , goal_{0, 0}
+    , goal_node_(kNoParent)
+    , state_(State::IDLE)
+    , expanded_(0) {
+    // 부하율 0.5 이하의 2의 거듭제곱 슬롯
+    size_t slot_count = 1;
+    while (slot_count < max_nodes_ * 2) {
+        slot_count <<= 1;
+    }
+    slots_.assign(slot_count, Slot{0, 0, 0});
+    slot_mask_ = static_cast<uint32_t>(slot_count - 1);
+    nodes_.reserve(max_nodes_);
+    open_.reserve(max_nodes_);
+
+    row_bits_.assign(row_words_ * height_, 0);
+    column_bits_.assign(column_words_ * width_, 0);
+    for (uint32_t y = 0; y < height_; ++y) {
+        for (uint32_t x = 0; x < width_; ++x) {
+            if (map.IsWalkable(static_cast<int32_t>(x), static_cast<int32_t>(y))) {
+                row_bits_[y * row_words_ + (x >> 6)] |= uint64_t(1) << (x & 63);
+                column_bits_[x * column_words_ + (y >> 6)] |= uint64_t(1) << (y & 63);
+            }
+        }
+    }
+}
+
+const uint64_t* PathFinder::Row(int32_t y) const {
+    return static_cast<uint32_t>(y) < height_ ? &row_bits_[static_cast<size_t>(y) * row_words_] : nullptr;
+}
+
+const uint64_t* PathFinder::Column(int32_t x) const {
+    return static_cast<uint32_t>(x) < width_ ? &column_bits_[static_cast<size_t>(x) * column_words_] : nullptr;
+}
+
+float PathFinder::Heuristic(int32_t x, int32_t y) const {
+    return Octile(goal_.x - x, goal_.y - y);
+}
+
+void PathFinder::Begin(PathPoint start, PathPoint goal) {
+    if (++generation_ == 0) {
+        // 세대 번호가 한 바퀴 돌면 그때만 슬롯을 지운다
+        std::fill(slots_.begin(), slots_.end(), Slot{0, 0, 0});
+        generation_ = 1;
+    }
+    nodes_.clear();
+    open_.clear();
+    expanded_ = 0;
+    goal_node_ = kNoParent;
+    start_ = start;
+    goal_ = goal;
+
+    if (!Walkable(start.x, start.y) || !Walkable(goal.x, goal.y)) {
+        state_ = State::NOT_FOUND;
+        return;
+    }
+
+    bool created;
+    uint32_t node = FindOrCreate(CellOf(start.x, start.y), created);
+    nodes_[node].g = 0.0f;
+    open_.push_back(OpenEntry{Heuristic(start.x, start.y), node});
+    state_ = State::SEARCHING;
+}
+
+uint32_t PathFinder::FindOrCreate(uint32_t cell, bool& created) {
+    uint32_t slot = (cell * 2654435761u) & slot_mask_;
+    while (true) {
+        Slot& entry = slots_[slot];
+        if (entry.generation != generation_) {
+            if (nodes_.size() >= max_nodes_) {
+                return UINT32_MAX;
+            }
+            entry = Slot{generation_, cell, static_cast<uint32_t>(nodes_.size())};
+            nodes_.push_back(Node{cell, kNoParent, 0.0f, false});
+            created = true;
+            return entry.node;
+        }
+        if (entry.cell == cell) {
+            created = false;
+            return entry.node;
+        }
+        slot = (slot + 1) & slot_mask_;
+    }
+}
+
+PathFinder::State PathFinder::Step(size_t max_expansions) {
+    size_t expansions = 0;
+    while (state_ == State::SEARCHING && expansions < max_expansions) {
+        if (open_.empty()) {
+            state_ = State::NOT_FOUND;
+            break;
+        }
+
+        std::pop_heap(open_.begin(), open_.end());
+        uint32_t index = open_.back().node;
+        open_.pop_back();
+
+        // 같은 노드가 더 낮은 비용으로 다시 들어간 경우의 남은 항목
+        if (nodes_[index].closed) {
+            continue;
+        }
+        nodes_[index].closed = true;
+        ++expanded_;
+        ++expansions;
+
+        if (nodes_[index].cell == CellOf(goal_.x, goal_.y)) {
+            goal_node_ = index;
+            state_ = State::FOUND;
+            break;
+        }
+        Expand(index);
+    }
+    return state_;
+}
+
+void PathFinder::Expand(uint32_t node_index) {
+    const Node& node = nodes_[node_index];
+    int32_t x = static_cast<int32_t>(node.cell % width_);
+    int32_t y = static_cast<int32_t>(node.cell / width_);
+
+    // 가지치기한 이웃 방향 - 부모가 없으면 8방향 전부
+    int32_t directions[8][2];
+    int count = 0;
+    auto add = [&](int32_t dx, int32_t dy) {
+        directions[count][0] = dx;
+        directions[count][1] = dy;
+        ++count;
+    };
+
+    if (node.parent == kNoParent) {
+        for (int32_t dy = -1; dy <= 1; ++dy) {
+            for (int32_t dx = -1; dx <= 1; ++dx) {
+                if ((dx != 0 || dy != 0) && (dx == 0 || dy == 0 || (Walkable(x + dx, y) && Walkable(x, y + dy)))) {
+                    add(dx, dy);
+                }
+            }
+        }
+    } else {
+        const Node& parent = nodes_[node.parent];
+        int32_t dx = Sign(x - static_cast<int32_t>(parent.cell % width_));
+        int32_t dy = Sign(y - static_cast<int32_t>(parent.cell / width_));
+
+        if (dx != 0 && dy != 0) {
+            bool vertical = Walkable(x, y + dy);
+            bool horizontal = Walkable(x + dx, y);
+            if (vertical) add(0, dy);
+            if (horizontal) add(dx, 0);
+            if (vertical && horizontal) add(dx, dy);
+        } else if (dx != 0) {
+            bool next = Walkable(x + dx, y);
+            bool down = Walkable(x, y + 1);
+            bool up = Walkable(x, y - 1);
+            if (next) {
+                add(dx, 0);
+                if (down) add(dx, 1);
+                if (up) add(dx, -1);
+            }
+            if (down) add(0, 1);
+            if (up) add(0, -1);
+        } else {
+            bool next = Walkable(x, y + dy);
+            bool right = Walkable(x + 1, y);
+            bool left = Walkable(x - 1, y);
+            if (next) {
+                add(0, dy);
+                if (right) add(1, dy);
+                if (left) add(-1, dy);
+            }
+            if (right) add(1, 0);
+            if (left) add(-1, 0);
+        }
+    }
+
+    for (int i = 0; i < count && state_ == State::SEARCHING; ++i) {
+        int32_t jx, jy;
+        if (Jump(x + directions[i][0], y + directions[i][1], directions[i][0], directions[i][1], jx, jy)) {
+            PushSuccessor(node_index, x, y, jx, jy);
+        }
+    }
+}
+
+void PathFinder::PushSuccessor(uint32_t from, int32_t fx, int32_t fy, int32_t x, int32_t y) {
+    float g = nodes_[from].g + Octile(x - fx, y - fy);
+
+    bool created;
+    uint32_t index = FindOrCreate(CellOf(x, y), created);
+    if (index == UINT32_MAX) {
+        state_ = State::LIMIT_REACHED;
+        return;
+    }
+
+    Node& node = nodes_[index];
+    if (node.closed || (!created && g >= node.g)) {
+        return;
+    }
+    node.g = g;
+    node.parent = from;
+    open_.push_back(OpenEntry{g + Heuristic(x, y), index});
+    std::push_heap(open_.begin(), open_.end());
+}
+
+// (x, y)에서 (dx, dy) 방향으로 진행하며 다음 점프 포인트를 찾는다
+// 대각선은 kMaxDiagonalJump칸을 가면 그 자리를 점프 포인트로 돌려준다. 노드가 늘 뿐 경로는 같고,
+// 넓은 빈 공간에서 확장 한 번이 지나치게 길어져 틱 예산을 넘는 것을 막는다.
+bool PathFinder::Jump(int32_t x, int32_t y, int32_t dx, int32_t dy, int32_t& jx, int32_t& jy) const {
+    if (dx == 0 || dy == 0) {
+        return JumpStraight(x, y, dx, dy, jx, jy);
+    }
+
+    for (int32_t distance = 1; ; ++distance) {
+        if (!Walkable(x, y)) {
+            return false;
+        }
+
+        // 골이거나, 가로/세로 방향에 점프 포인트가 있으면 여기서 멈춘다
+        int32_t ignored_x, ignored_y;
+        if ((x == goal_.x && y == goal_.y) || distance >= kMaxDiagonalJump ||
+            JumpStraight(x + dx, y, dx, 0, ignored_x, ignored_y) ||
+            JumpStraight(x, y + dy, 0, dy, ignored_x, ignored_y)) {
+            jx = x;
+            jy = y;
+            return true;
+        }
+
+        // 모서리를 가로지르지 않는다
+        if (!Walkable(x + dx, y) || !Walkable(x, y + dy)) {
+            return false;
+        }
+        x += dx;
+        y += dy;
+    }
+}
+
+bool PathFinder::JumpStraight(int32_t x, int32_t y, int32_t dx, int32_t dy, int32_t& jx, int32_t& jy) const {
+    int32_t found;
+    if (dx != 0) {
+        if (!ScanLine(Row(y), Row(y - 1), Row(y + 1), static_cast<int32_t>(width_), x, dx,
+                      goal_.y == y ? goal_.x : -1, found)) {
+            return false;
+        }
+        jx = found;
+        jy = y;
+    } else {
+        if (!ScanLine(Column(x), Column(x - 1), Column(x + 1), static_cast<int32_t>(height_), y, dy,
+                      goal_.x == x ? goal_.y : -1, found)) {
+            return false;
+        }
+        jx = x;
+        jy = found;
+    }
+    return true;
+}
+
+// 진행 방향으로 칸 c에서 옆줄 칸이 열려 있는데 바로 뒤(c - direction) 옆줄 칸이 막혀 있으면 강제 이웃
+// (부모에서는 대각선으로 갈 수 없던 칸) - 첫 막힌 칸보다 앞에 있는 첫 강제 이웃 또는 골이 점프 포인트다.
+bool PathFinder::ScanLine(const uint64_t* line, const uint64_t* side_a, const uint64_t* side_b, int32_t length,
+                          int32_t position, int32_t direction, int32_t goal, int32_t& found) const {
+    if (direction > 0) {
+        for (int32_t start = position; start < length; start += 64) {
+            uint64_t blocked = ~ExtractBits(line, length, start);
+            uint64_t forced = (ExtractBits(side_a, length, start) & ~ExtractBits(side_a, length, start - 1)) |
+                              (ExtractBits(side_b, length, start) & ~ExtractBits(side_b, length, start - 1));
+            if (goal >= start && goal < start + 64) {
+                forced |= uint64_t(1) << (goal - start);
+            }
+            int first_blocked = blocked ? LowestBit(blocked) : 64;
+            int first_forced = forced ? LowestBit(forced) : 64;
+            if (first_forced < first_blocked) {
+                found = start + first_forced;
+                return true;
+            }
+            if (first_blocked < 64) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    // 역방향은 [end - 63, end] 구간을 위쪽 비트부터 본다
+    for (int32_t end = position; end >= 0; end -= 64) {
+        int32_t start = end - 63;
+        uint64_t blocked = ~ExtractBits(line, length, start);
+        uint64_t forced = (ExtractBits(side_a, length, start) & ~ExtractBits(side_a, length, start + 1)) |
+                          (ExtractBits(side_b, length, start) & ~ExtractBits(side_b, length, start + 1));
+        if (goal >= start && goal <= end) {
+            forced |= uint64_t(1) << (goal - start);
+        }
+        int last_blocked = blocked ? HighestBit(blocked) : -1;
+        int last_forced = forced ? HighestBit(forced) : -1;
+        if (last_forced > last_blocked) {
+            found = start + last_forced;
+            return true;
+        }
+        if (last_blocked >= 0) {
+            return false;
+        }
+    }
+    return false;
+}
+
+void PathFinder::ExtractPath(Path& path) const {
+    path.clear();
+    if (state_ != State::FOUND) {
+        return;
+    }
+    for (uint32_t index = goal_node_; index != kNoParent; index = nodes_[index].parent) {
+        uint32_t cell = nodes_[index].cell;
+        path.push_back(PathPoint{static_cast<int32_t>(cell % width_), static_cast<int32_t>(cell / width_)});
+    }
+    std::reverse(path.begin(), path.end());
+}
+
+PathService::PathService(const CollisionMap& map, size_t cache_capacity, size_t max_search_nodes)
+    : map_(map)
+    , finder_(map, max_search_nodes)
+    , searching_(false)
+    , next_request_id_(0)
+    , cache_capacity_(cache_capacity)
+    , stats_{} {
+    cache_index_.reserve(cache_capacity_);
+}
+
+uint32_t PathService::Request(PathPoint start, PathPoint goal, Callback callback) {
+    if (++next_request_id_ == 0) {
+        next_request_id_ = 1;
+    }
+    pending_.push_back(PendingRequest{next_request_id_, start, goal, std::move(callback)});
+    ++stats_.requests;
+    return next_request_id_;
+}
+
+void PathService::Cancel(uint32_t request_id) {
+    for (auto it = pending_.begin(); it != pending_.end(); ++it) {
+        if (it->id != request_id) {
+            continue;
+        }
+        if (it == pending_.begin() && searching_) {
+            stats_.expanded_nodes += finder_.GetExpandedCount();
+            finder_.Abort();
+            searching_ = false;
+        }
+        pending_.erase(it);
+        ++stats_.cancelled;
+        return;
+    }
+}
+
+void PathService::Update(std::chrono::microseconds budget) {
+    auto start = Clock::now();
+    auto deadline = start + budget;
+
+    while (!pending_.empty() && Clock::now() < deadline) {
+        if (!searching_) {
+            if (TryResolveImmediately(pending_.front())) {
+                continue;
+            }
+            finder_.Begin(pending_.front().start, pending_.front().goal);
+            searching_ = true;
+        }
+
+        PathFinder::State state = finder_.Step(kExpansionsPerCheck);
+        if (state == PathFinder::State::SEARCHING) {
+            continue;
+        }
+
+        searching_ = false;
+        stats_.expanded_nodes += finder_.GetExpandedCount();
+        if (state == PathFinder::State::LIMIT_REACHED) {
+            // 한도 때문에 멈춘 탐색은 "경로 없음"이 아니다 - 캐시하지 않는다
+            CompleteFront(PathStatus::LIMIT_REACHED, nullptr, false);
+            continue;
+        }
+        std::shared_ptr<const Path> path;
+        if (state == PathFinder::State::FOUND) {
+            auto found = std::make_shared<Path>();
+            finder_.ExtractPath(*found);
+            path = std::move(found);
+        }
+        PathStatus status = path ? PathStatus::FOUND : PathStatus::NOT_FOUND;
+        StoreCache(CacheKey(pending_.front().start, pending_.front().goal), path);
+        CompleteFront(status, std::move(path), false);
+    }
+
+    if (!pending_.empty()) {
+        ++stats_.budget_exhausted;
+    }
+    double elapsed_us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    stats_.max_update_us = std::max(stats_.max_update_us, elapsed_us);
+}
+
+bool PathService::TryResolveImmediately(const PendingRequest& request) {
+    if (!map_.IsWalkable(request.start.x, request.start.y) || !map_.IsWalkable(request.goal.x, request.goal.y)) {
+        CompleteFront(PathStatus::NOT_FOUND, nullptr, false);
+        return true;
+    }
+    if (request.start == request.goal) {
+        CompleteFront(PathStatus::FOUND, std::make_shared<const Path>(Path{request.start}), false);
+        return true;
+    }
+
+    std::shared_ptr<const Path> path;
+    if (LookupCache(CacheKey(request.start, request.goal), path)) {
+        ++stats_.cache_hits;
+        PathStatus status = path ? PathStatus::FOUND : PathStatus::NOT_FOUND;
+        CompleteFront(status, std::move(path), true);
+        return true;
+    }
+    return false;
+}
+
+void PathService::CompleteFront(PathStatus status, std::shared_ptr<const Path> path, bool from_cache) {
+    PendingRequest request = std::move(pending_.front());
+    pending_.pop_front();
+
+    if (status == PathStatus::FOUND) {
+        ++stats_.found;
+    } else if (status == PathStatus::LIMIT_REACHED) {
+        ++stats_.limit_reached;
+    } else {
+        ++stats_.not_found;
+    }
+    if (request.callback) {
+        request.callback(request.id, PathResult{status, std::move(path), from_cache});
+    }
+}
+
+uint64_t PathService::CacheKey(PathPoint start, PathPoint goal) const {
+    uint64_t width = static_cast<uint64_t>(map_.GetWidth());
+    uint64_t start_cell = static_cast<uint64_t>(start.y) * width + static_cast<uint64_t>(start.x);
+    uint64_t goal_cell = static_cast<uint64_t>(goal.y) * width + static_cast<uint64_t>(goal.x);
+    return (start_cell << 32) | goal_cell;
+}
+
+bool PathService::LookupCache(uint64_t key, std::shared_ptr<const Path>& path) {
+    auto it = cache_index_.find(key);
+    if (it == cache_index_.end()) {
+        return false;
+    }
+    cache_.splice(cache_.begin(), cache_, it->second);
+    path = it->second->second;
+    return true;
+}
+
+void PathService::StoreCache(uint64_t key, std::shared_ptr<const Path> path) {
+    if (cache_capacity_ == 0) {
+        return;
+    }
+    auto it = cache_index_.find(key);
+    if (it != cache_index_.end()) {
+        it->second->second = std::move(path);
+        cache_.splice(cache_.begin(), cache_, it->second);
+        return;
+    }
+
+    cache_.emplace_front(key, std::move(path));
+    cache_index_[key] = cache_.begin();
+    if (cache_.size() > cache_capacity_) {
+        cache_index_.erase(cache_.back().first);
+        cache_.pop_back();
+    }
+}
+
+void PathService::ClearCache() {
+    cache_.clear();
+    cache_index_.clear();
+}
+
+PathService::Stats PathService::GetStats() const {
+    Stats stats = stats_;
+    stats.pending = pending_.size();
+    stats.cached = cache_.size();
+    return stats;
+}
+
+} // namespace Common
@@ -0,0 +1,195 @@
+// common/path_finder.h
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "collision_map.h"
+
+namespace Common {
+
+struct PathPoint {
+    int32_t x, y;
+
+    bool operator==(const PathPoint& other) const { return x == other.x && y == other.y; }
+};
+
+// 시작점부터 도착점까지의 점프 포인트 목록 - 인접한 두 점은 8방향 중 한 방향의 직선으로 이어진다
+using Path = std::vector<PathPoint>;
+
+// Jump Point Search (8방향, 대각선은 양옆 두 칸이 모두 비어 있을 때만)
+// 가로/세로 점프는 생성 시 만든 행/열 비트셋을 64칸씩 훑는다 (맵은 읽기 전용이라 한 번만 만든다).
+// 노드/해시 슬롯/열린 목록을 생성 시 max_nodes 기준으로 한 번 잡아 두고 질의마다 재사용한다.
+// 해시 슬롯은 세대 번호로 무효화하므로 질의 시작 시 지우지 않는다.
+// 탐색은 Step 단위로 나눠 실행할 수 있어 틱 예산 안에서 끊었다가 이어갈 수 있다.
+class PathFinder {
+public:
+    enum class State {
+        IDLE,
+        SEARCHING,
+        FOUND,
+        NOT_FOUND,      // 경로 없음
+        LIMIT_REACHED   // 노드 한도 초과 - 경로가 있을 수도 있다
+    };
+
+    PathFinder(const CollisionMap& map, size_t max_nodes);
+
+    void Begin(PathPoint start, PathPoint goal);
+    // 최대 max_expansions개 노드를 확장하고 현재 상태 반환
+    State Step(size_t max_expansions);
+    void Abort() { state_ = State::IDLE; }
+
+    State GetState() const { return state_; }
+    size_t GetExpandedCount() const { return expanded_; }
+    // FOUND일 때만 유효
+    void ExtractPath(Path& path) const;
+
+private:
+    static constexpr uint32_t kNoParent = UINT32_MAX;
+    static constexpr int32_t kMaxDiagonalJump = 64;
+
+    struct Node {
+        uint32_t cell;
+        uint32_t parent;    // 노드 인덱스
+        float g;
+        bool closed;
+    };
+
+    struct OpenEntry {
+        float f;
+        uint32_t node;
+
+        bool operator<(const OpenEntry& other) const { return f > other.f; }  // 최소 힙
+    };
+
+    struct Slot {
+        uint32_t generation;
+        uint32_t cell;
+        uint32_t node;
+    };
+
+    bool Walkable(int32_t x, int32_t y) const { return map_.IsWalkable(x, y); }
+    uint32_t CellOf(int32_t x, int32_t y) const { return static_cast<uint32_t>(y) * width_ + static_cast<uint32_t>(x); }
+    float Heuristic(int32_t x, int32_t y) const;
+
+    // 노드가 없으면 만든다 - 한도에 닿으면 UINT32_MAX
+    uint32_t FindOrCreate(uint32_t cell, bool& created);
+    void Expand(uint32_t node_index);
+    void PushSuccessor(uint32_t from, int32_t fx, int32_t fy, int32_t x, int32_t y);
+    bool Jump(int32_t x, int32_t y, int32_t dx, int32_t dy, int32_t& jx, int32_t& jy) const;
+    bool JumpStraight(int32_t x, int32_t y, int32_t dx, int32_t dy, int32_t& jx, int32_t& jy) const;
+    // 한 줄(행 또는 열)을 position부터 direction(+1/-1) 방향으로 훑어 점프 포인트 위치를 찾는다
+    bool ScanLine(const uint64_t* line, const uint64_t* side_a, const uint64_t* side_b, int32_t length,
+                  int32_t position, int32_t direction, int32_t goal, int32_t& found) const;
+    const uint64_t* Row(int32_t y) const;
+    const uint64_t* Column(int32_t x) const;
+
+    const CollisionMap& map_;
+    uint32_t width_;
+    uint32_t height_;
+    size_t max_nodes_;
+
+    // 통행 비트셋 - 행 우선(비트 = x)과 전치(비트 = y)
+    size_t row_words_;
+    size_t column_words_;
+    std::vector<uint64_t> row_bits_;
+    std::vector<uint64_t> column_bits_;
+
+    std::vector<Node> nodes_;
+    std::vector<Slot> slots_;
+    uint32_t slot_mask_;
+    uint32_t generation_;
+    std::vector<OpenEntry> open_;
+
+    PathPoint start_;
+    PathPoint goal_;
+    uint32_t goal_node_;
+    State state_;
+    size_t expanded_;
+};
+
+enum class PathStatus {
+    FOUND,
+    NOT_FOUND,
+    LIMIT_REACHED   // 탐색 노드 한도에서 멈췄다 - 캐시하지 않으므로 다시 요청하면 다시 탐색한다
+};
+
+struct PathResult {
+    PathStatus status;
+    std::shared_ptr<const Path> path;   // FOUND일 때만
+    bool from_cache;
+};
+
+// 경로 탐색 서비스
+// 요청은 큐에 쌓이고 Update가 주어진 시간 예산 안에서만 처리한다 - 끝나지 않은 탐색은 다음 틱에 이어간다.
+// 최근 결과(경로 없음 포함, 노드 한도 초과는 제외)는 (시작 셀, 도착 셀) 키의 LRU 캐시에 남겨
+// 같은 질의를 바로 돌려준다.
+// 콜백은 Update 안에서 호출된다 (취소한 요청은 호출되지 않는다). 스레드 안전하지 않다 - 존 틱과 같은 락 아래에서 사용한다.
+class PathService {
+public:
+    using Callback = std::function<void(uint32_t request_id, const PathResult& result)>;
+
+    struct Stats {
+        uint64_t requests;
+        uint64_t cache_hits;
+        uint64_t found;
+        uint64_t not_found;
+        uint64_t limit_reached;
+        uint64_t cancelled;
+        uint64_t expanded_nodes;
+        uint64_t budget_exhausted;  // 예산을 다 써서 대기 요청을 남긴 Update 수
+        size_t pending;
+        size_t cached;
+        double max_update_us;
+    };
+
+    PathService(const CollisionMap& map, size_t cache_capacity, size_t max_search_nodes);
+
+    uint32_t Request(PathPoint start, PathPoint goal, Callback callback);
+    void Cancel(uint32_t request_id);
+    void Update(std::chrono::microseconds budget);
+    void ClearCache();
+
+    Stats GetStats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+    using CacheList = std::list<std::pair<uint64_t, std::shared_ptr<const Path>>>;
+
+    static constexpr size_t kExpansionsPerCheck = 1;    // 점프 한 번이 길 수 있어 확장마다 시간을 본다
+
+    struct PendingRequest {
+        uint32_t id;
+        PathPoint start;
+        PathPoint goal;
+        Callback callback;
+    };
+
+    uint64_t CacheKey(PathPoint start, PathPoint goal) const;
+    bool LookupCache(uint64_t key, std::shared_ptr<const Path>& path);
+    void StoreCache(uint64_t key, std::shared_ptr<const Path> path);
+    // 큐 맨 앞 요청을 꺼내 콜백 호출 (콜백 안에서 Request/Cancel을 불러도 안전하도록 먼저 꺼낸다)
+    void CompleteFront(PathStatus status, std::shared_ptr<const Path> path, bool from_cache);
+    // 캐시나 즉시 판정으로 끝나면 true
+    bool TryResolveImmediately(const PendingRequest& request);
+
+    const CollisionMap& map_;
+    PathFinder finder_;
+    std::deque<PendingRequest> pending_;
+    bool searching_;            // pending_.front()를 탐색 중
+    uint32_t next_request_id_;
+
+    size_t cache_capacity_;
+    CacheList cache_;           // 앞쪽이 최근
+    std::unordered_map<uint64_t, CacheList::iterator> cache_index_;
+
+    Stats stats_;
+};
+
+} // namespace Common
@@ -0,0 +1,52 @@
+// common/spatial_grid.cpp
+#include "spatial_grid.h"
+
+namespace Common {
+
+SpatialGrid::SpatialGrid(int32_t width, int32_t height, int32_t cell_size)
+    : cell_size_(std::max(1, cell_size))
+    , columns_(std::max(1, (width + cell_size_ - 1) / cell_size_))
+    , rows_(std::max(1, (height + cell_size_ - 1) / cell_size_))
+    , cells_(static_cast<size_t>(columns_) * rows_)
+    , entity_count_(0) {
+}
+
+void SpatialGrid::Insert(EntityHandle handle, int32_t x, int32_t y) {
+    cells_[CellIndex(x, y)].push_back(Entry{handle, x, y});
+    ++entity_count_;
+}
+
+void SpatialGrid::Remove(EntityHandle handle, int32_t x, int32_t y) {
+    auto& cell = cells_[CellIndex(x, y)];
+    for (size_t i = 0; i < cell.size(); ++i) {
+        if (cell[i].handle == handle) {
+            cell[i] = cell.back();
+            cell.pop_back();
+            --entity_count_;
+            return;
+        }
+    }
+}
+
+void SpatialGrid::Move(EntityHandle handle, int32_t old_x, int32_t old_y, int32_t new_x, int32_t new_y) {
+    size_t old_index = CellIndex(old_x, old_y);
+    size_t new_index = CellIndex(new_x, new_y);
+
+    auto& cell = cells_[old_index];
+    for (size_t i = 0; i < cell.size(); ++i) {
+        if (cell[i].handle != handle) {
+            continue;
+        }
+        if (old_index == new_index) {
+            cell[i].x = new_x;
+            cell[i].y = new_y;
+        } else {
+            cell[i] = cell.back();
+            cell.pop_back();
+            cells_[new_index].push_back(Entry{handle, new_x, new_y});
+        }
+        return;
+    }
+}
+
+} // namespace Common
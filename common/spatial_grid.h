@@ -0,0 +1,72 @@
+// common/spatial_grid.h
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "entity_store.h"
+
+namespace Common {
+
+// 균일 격자 공간 해시 - 관심 영역(AOI) 질의용
+// 맵을 cell_size 크기의 정사각 셀로 나누고 셀마다 엔티티 목록을 둔다.
+// 이동은 셀이 바뀔 때만 목록 사이를 옮기고, 같은 셀 안에서는 좌표만 갱신한다.
+// cell_size를 시야 거리로 잡으면 반경 질의는 주변 3x3 셀만 훑는다.
+// 스레드 안전하지 않다 - 호출하는 쪽에서 잠근다.
+class SpatialGrid {
+public:
+    struct Entry {
+        EntityHandle handle;
+        int32_t x;
+        int32_t y;
+    };
+
+    SpatialGrid(int32_t width, int32_t height, int32_t cell_size);
+
+    void Insert(EntityHandle handle, int32_t x, int32_t y);
+    void Remove(EntityHandle handle, int32_t x, int32_t y);
+    void Move(EntityHandle handle, int32_t old_x, int32_t old_y, int32_t new_x, int32_t new_y);
+
+    // (x, y)에서 유클리드 거리 radius 이내의 엔티티마다 visitor(const Entry&) 호출
+    template<typename Visitor>
+    void QueryRadius(int32_t x, int32_t y, int32_t radius, Visitor&& visitor) const {
+        int32_t min_cx = CellCoord(x - radius, columns_);
+        int32_t max_cx = CellCoord(x + radius, columns_);
+        int32_t min_cy = CellCoord(y - radius, rows_);
+        int32_t max_cy = CellCoord(y + radius, rows_);
+        int64_t radius_sq = static_cast<int64_t>(radius) * radius;
+
+        for (int32_t cy = min_cy; cy <= max_cy; ++cy) {
+            for (int32_t cx = min_cx; cx <= max_cx; ++cx) {
+                for (const Entry& entry : cells_[static_cast<size_t>(cy) * columns_ + cx]) {
+                    int64_t dx = entry.x - x;
+                    int64_t dy = entry.y - y;
+                    if (dx * dx + dy * dy <= radius_sq) {
+                        visitor(entry);
+                    }
+                }
+            }
+        }
+    }
+
+    int32_t GetCellSize() const { return cell_size_; }
+    size_t GetCellCount() const { return cells_.size(); }
+    size_t GetEntityCount() const { return entity_count_; }
+
+private:
+    int32_t CellCoord(int32_t value, int32_t limit) const {
+        return std::clamp(value / cell_size_, 0, limit - 1);
+    }
+    size_t CellIndex(int32_t x, int32_t y) const {
+        return static_cast<size_t>(CellCoord(y, rows_)) * columns_ + CellCoord(x, columns_);
+    }
+
+    int32_t cell_size_;
+    int32_t columns_;
+    int32_t rows_;
+    std::vector<std::vector<Entry>> cells_;
+    size_t entity_count_;
+};
+
+} // namespace Common
@@ -0,0 +1,156 @@
+// common/tick_scheduler.cpp
+#include "tick_scheduler.h"
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace Common {
+
+namespace {
+
+TickScheduler::Clock::duration PeriodFor(int tick_rate) {
+    return std::chrono::duration_cast<TickScheduler::Clock::duration>(
+        std::chrono::nanoseconds(1000000000LL / std::max(1, tick_rate)));
+}
+
+double ToMillis(int64_t nanoseconds) {
+    return nanoseconds / 1000000.0;
+}
+
+} // anonymous namespace
+
+TickCatchUpPolicy ParseTickCatchUpPolicy(const std::string& policy) {
+    return policy == "catch_up" ? TickCatchUpPolicy::CATCH_UP : TickCatchUpPolicy::SKIP;
+}
+
+TickScheduler::TickScheduler(int tick_rate, TickCatchUpPolicy policy, int max_catch_up_ticks)
+    : tick_rate_(std::max(1, tick_rate))
+    , pending_tick_rate_(0)
+    , policy_(policy)
+    , max_catch_up_ticks_(std::max(1, max_catch_up_ticks))
+    , period_(PeriodFor(tick_rate)) {
+    ResetStats();
+}
+
+void TickScheduler::SetTickRate(int tick_rate) {
+    pending_tick_rate_.store(std::max(1, tick_rate), std::memory_order_relaxed);
+}
+
+void TickScheduler::Start() {
+    next_deadline_ = Clock::now() + period_;
+}
+
+void TickScheduler::ApplyPendingRate(Clock::time_point now) {
+    int rate = pending_tick_rate_.exchange(0, std::memory_order_relaxed);
+    if (rate == 0) {
+        return;
+    }
+    tick_rate_.store(rate, std::memory_order_relaxed);
+    period_ = PeriodFor(rate);
+    next_deadline_ = now + period_;
+}
+
+int TickScheduler::WaitForNextTick() {
+    ApplyPendingRate(Clock::now());
+    std::this_thread::sleep_until(next_deadline_);
+
+    // 놓친 데드라인 수 계산 - 데드라인은 항상 주기의 정수배로만 전진한다
+    auto now = Clock::now();
+    int64_t due = 1;
+    if (now > next_deadline_) {
+        due += (now - next_deadline_) / period_;
+    }
+    next_deadline_ += period_ * due;
+
+    int64_t run = 1;
+    if (policy_ == TickCatchUpPolicy::CATCH_UP) {
+        run = std::min<int64_t>(due, max_catch_up_ticks_);
+    }
+
+    if (due > run) {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        skipped_ticks_ += static_cast<uint64_t>(due - run);
+    }
+    return static_cast<int>(run);
+}
+
+void TickScheduler::BeginTick() {
+    tick_start_ = Clock::now();
+}
+
+void TickScheduler::EndTick() {
+    auto now = Clock::now();
+    int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - tick_start_).count();
+    int64_t slack = std::chrono::duration_cast<std::chrono::nanoseconds>(next_deadline_ - now).count();
+    int64_t period = std::chrono::duration_cast<std::chrono::nanoseconds>(period_).count();
+
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    samples_ns_[sample_cursor_] = elapsed;
+    sample_cursor_ = (sample_cursor_ + 1) % kSampleCount;
+    sample_count_ = std::min(sample_count_ + 1, kSampleCount);
+
+    ++ticks_;
+    total_ns_ += elapsed;
+    max_ns_ = std::max(max_ns_, elapsed);
+    if (elapsed > period) {
+        ++overruns_;
+    }
+    last_slack_ns_ = slack;
+    min_slack_ns_ = std::min(min_slack_ns_, slack);
+}
+
+TickScheduler::Stats TickScheduler::GetStats() const {
+    std::vector<int64_t> samples;
+    Stats stats{};
+    stats.tick_rate = GetTickRate();
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        samples.assign(samples_ns_.begin(), samples_ns_.begin() + sample_count_);
+        stats.ticks = ticks_;
+        stats.overruns = overruns_;
+        stats.skipped_ticks = skipped_ticks_;
+        stats.avg_ms = ticks_ > 0 ? ToMillis(total_ns_) / ticks_ : 0.0;
+        stats.max_ms = ToMillis(max_ns_);
+        stats.last_slack_ms = ticks_ > 0 ? ToMillis(last_slack_ns_) : 0.0;
+        stats.min_slack_ms = ticks_ > 0 ? ToMillis(min_slack_ns_) : 0.0;
+    }
+
+    // 백분위는 최근 kSampleCount 틱 기준
+    if (!samples.empty()) {
+        std::sort(samples.begin(), samples.end());
+        stats.p50_ms = ToMillis(samples[(samples.size() - 1) * 50 / 100]);
+        stats.p99_ms = ToMillis(samples[(samples.size() - 1) * 99 / 100]);
+    }
+    return stats;
+}
+
+void TickScheduler::ResetStats() {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    samples_ns_.fill(0);
+    sample_count_ = 0;
+    sample_cursor_ = 0;
+    ticks_ = 0;
+    overruns_ = 0;
+    skipped_ticks_ = 0;
+    total_ns_ = 0;
+    max_ns_ = 0;
+    last_slack_ns_ = 0;
+    min_slack_ns_ = std::numeric_limits<int64_t>::max();
+}
+
+std::string TickScheduler::Stats::Describe() const {
+    char line[256];
+    std::snprintf(line, sizeof(line),
+                  "rate=%d ticks=%llu overruns=%llu skipped=%llu avg=%.3fms p50=%.3fms p99=%.3fms max=%.3fms "
+                  "slack=%.3fms min_slack=%.3fms",
+                  tick_rate,
+                  static_cast<unsigned long long>(ticks),
+                  static_cast<unsigned long long>(overruns),
+                  static_cast<unsigned long long>(skipped_ticks),
+                  avg_ms, p50_ms, p99_ms, max_ms, last_slack_ms, min_slack_ms);
+    return line;
+}
+
+} // namespace Common
@@ -0,0 +1,85 @@
+// common/tick_scheduler.h
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace Common {
+
+// 데드라인을 놓쳤을 때의 처리 방식
+enum class TickCatchUpPolicy {
+    SKIP,       // 밀린 틱은 버리고 한 틱만 실행
+    CATCH_UP    // 밀린 틱을 연속 실행 (max_catch_up_ticks까지, 나머지는 버림)
+};
+
+TickCatchUpPolicy ParseTickCatchUpPolicy(const std::string& policy); // "catch_up" 외에는 SKIP
+
+// 고정 타임스텝 틱 스케줄러
+// 데드라인을 절대 시각(start + n * period)으로 유지해 지연이 누적되지 않으며,
+// 다음 데드라인까지는 폴링 대신 sleep_until로 잠든다.
+// 틱마다 실행 시간과 여유 시간(slack)을 기록하고, 최근 실행 시간 샘플로 백분위를 계산한다.
+class TickScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Stats {
+        int tick_rate;
+        uint64_t ticks;             // 실행한 틱 수
+        uint64_t overruns;          // 실행 시간이 틱 주기를 넘은 횟수
+        uint64_t skipped_ticks;     // 정책에 따라 버린 틱 수
+        double avg_ms;
+        double p50_ms;
+        double p99_ms;
+        double max_ms;
+        double last_slack_ms;       // 마지막 틱 종료 시점부터 다음 데드라인까지 (음수면 지각)
+        double min_slack_ms;
+
+        std::string Describe() const;
+    };
+
+    TickScheduler(int tick_rate, TickCatchUpPolicy policy, int max_catch_up_ticks = 5);
+
+    // 다른 스레드에서 호출 가능 - 다음 대기 시점에 적용되며 위상은 그 시각으로 재설정된다
+    void SetTickRate(int tick_rate);
+    int GetTickRate() const { return tick_rate_.load(std::memory_order_relaxed); }
+
+    // 틱 스레드 전용
+    void Start();
+    int WaitForNextTick();      // 다음 데드라인까지 대기 후 이번에 실행할 틱 수 (1 이상)
+    void BeginTick();
+    void EndTick();
+
+    Stats GetStats() const;
+    void ResetStats();
+
+private:
+    static constexpr size_t kSampleCount = 1024;
+
+    void ApplyPendingRate(Clock::time_point now);
+
+    std::atomic<int> tick_rate_;
+    std::atomic<int> pending_tick_rate_;
+    TickCatchUpPolicy policy_;
+    int max_catch_up_ticks_;
+
+    Clock::duration period_;
+    Clock::time_point next_deadline_;
+    Clock::time_point tick_start_;
+
+    mutable std::mutex stats_mutex_;
+    std::array<int64_t, kSampleCount> samples_ns_;
+    size_t sample_count_;
+    size_t sample_cursor_;
+    uint64_t ticks_;
+    uint64_t overruns_;
+    uint64_t skipped_ticks_;
+    int64_t total_ns_;
+    int64_t max_ns_;
+    int64_t last_slack_ns_;
+    int64_t min_slack_ns_;
+};
+
+} // namespace Common
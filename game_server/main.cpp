@@ -1,12 +1,24 @@
 // game_server/main.cpp - Updated with Logging and Config
 #include "../network/network_manager.h"
+#include "../network/packet_schema.h"
+#include "../network/packet_dispatcher.h"
+#include "../network/mpsc_queue.h"
+#include "../network/snapshot_replicator.h"
 #include "../common/log_manager.h"
 #include "../common/config_manager.h"
+#include "../common/tick_scheduler.h"
+#include "../common/coarse_clock.h"
+#include "../common/job_system.h"
+#include "../common/entity_store.h"
 #include <iostream>
 #include <string>
+#include <string_view>
+#include <algorithm>
+#include <cstdlib>
 #include <chrono>
 #include <thread>
-#include <map>
+#include <unordered_map>
+#include <vector>
 #include <filesystem>
 
 // 로그 레벨 문자열을 enum으로 변환하는 헬퍼 함수
@@ -21,7 +33,12 @@ Common::LogLevel StringToLogLevel(const std::string& level) {
 
 class GameServer {
 public:
-    GameServer() {
+    GameServer()
+        : tick_scheduler_(Common::GameServerConfig::GetTickRate(),
+                          Common::ParseTickCatchUpPolicy(Common::GameServerConfig::GetTickCatchUpPolicy()),
+                          Common::GameServerConfig::GetMaxCatchUpTicks())
+        , job_system_(Common::GameServerConfig::GetJobThreads())
+        , inbound_queue_(static_cast<size_t>(std::max(1, Common::GameServerConfig::GetUpdateQueueSize()))) {
         // 설정 로드
         if (!Common::GameServerConfig::LoadConfig()) {
             LOG_WARNING("GAME", "Failed to load config, using defaults");
@@ -31,6 +48,7 @@ public:
         max_connections_ = Common::GameServerConfig::GetMaxConnections();
         game_tick_rate_ = Common::GameServerConfig::GetTickRate();
         log_level_ = Common::GameServerConfig::GetLogLevel();
+        player_move_speed_ = static_cast<float>(Common::GameServerConfig::GetPlayerMoveSpeed());
         game_running_ = false;
     }
 
@@ -42,39 +60,60 @@ public:
             Common::GameServerConfig::GetFileOutput(),
             Common::GameServerConfig::GetLogFile()
         );
+        Common::LogManager::Instance().SetAsyncMode(
+            Common::GameServerConfig::GetLogAsync(),
+            static_cast<size_t>(std::max(4, Common::GameServerConfig::GetLogBufferKb())) * 1024,
+            Common::ParseLogOverflowPolicy(Common::GameServerConfig::GetLogOverflowPolicy()),
+            std::chrono::milliseconds(Common::GameServerConfig::GetLogFlushIntervalMs()));
+        Common::LogRotationPolicy rotation;
+        rotation.max_file_bytes =
+            static_cast<uint64_t>(std::max(0, Common::GameServerConfig::GetLogRotateSizeMb())) << 20;
+        rotation.interval = std::chrono::minutes(std::max(0, Common::GameServerConfig::GetLogRotateIntervalMin()));
+        rotation.max_files = static_cast<size_t>(std::max(0, Common::GameServerConfig::GetLogRetainFiles()));
+        rotation.max_total_bytes =
+            static_cast<uint64_t>(std::max(0, Common::GameServerConfig::GetLogRetainTotalMb())) << 20;
+        rotation.compress = Common::GameServerConfig::GetLogCompress();
+        Common::LogManager::Instance().SetRotation(rotation);
+        if (Common::GameServerConfig::GetLogBinary()) {
+            Common::LogManager::Instance().SetBinaryOutput(true, Common::GameServerConfig::GetLogBinaryFile());
+        }
 
         LOG_INFO("GAME", "Initializing Game Server...");
         LOG_INFO_FORMAT("GAME", "Port: %d, Max Connections: %d, TPS: %d, Log Level: %s",
                        port_, max_connections_, game_tick_rate_, log_level_.c_str());
+        LOG_INFO_FORMAT("GAME", "I/O Threads: %d, Job Threads: %d, Inbound Queue: %zu",
+                       Common::GameServerConfig::GetWorkerThreads(), job_system_.GetWorkerCount(),
+                       inbound_queue_.GetCapacity());
 
-        if (!network_manager_.InitializeServer(port_, max_connections_)) {
+        if (!network_manager_.InitializeServer(port_, max_connections_,
+                                               Common::GameServerConfig::GetWorkerThreads())) {
             LOG_ERROR_FORMAT("GAME", "Failed to initialize Game Server on port %d", port_);
             return false;
         }
+        network_manager_.SetSendQueueLimit(
+            static_cast<size_t>(Common::GameServerConfig::GetSendQueueLimitKb()) * 1024,
+            Network::ParseSendOverflowPolicy(Common::GameServerConfig::GetSendOverflowPolicy()));
 
         // 콜백 설정
         network_manager_.SetOnClientConnected([this](std::shared_ptr<Network::Connection> conn) {
             LOG_INFO_FORMAT("GAME", "Player connected: %s (ID: %d)",
                            conn->GetAddress().c_str(), conn->GetId());
 
-            // 플레이어 세션 초기화
-            std::lock_guard<std::mutex> lock(players_mutex_);
-            player_sessions_[conn->GetId()] = {conn->GetId(), conn->GetAddress(), 0, 0};
-            LOG_DEBUG_FORMAT("GAME", "Player session created for ID: %d", conn->GetId());
+            // 플레이어 세션은 게임 루프 스레드에서 생성
+            PushLifecycleCommand(GameCommand::CONNECT, conn);
         });
 
         network_manager_.SetOnClientDisconnected([this](std::shared_ptr<Network::Connection> conn) {
             LOG_INFO_FORMAT("GAME", "Player disconnected: %s (ID: %d)",
                            conn->GetAddress().c_str(), conn->GetId());
 
-            // 플레이어 세션 제거
-            std::lock_guard<std::mutex> lock(players_mutex_);
-            player_sessions_.erase(conn->GetId());
-            LOG_DEBUG_FORMAT("GAME", "Player session removed for ID: %d", conn->GetId());
+            // 플레이어 세션 제거도 게임 루프 스레드에서
+            PushLifecycleCommand(GameCommand::DISCONNECT, conn);
         });
 
+        RegisterHandlers();
         network_manager_.SetOnPacketReceived([this](std::shared_ptr<Network::Connection> conn, const Network::Packet& packet) {
-            HandlePacket(conn, packet);
+            dispatcher_.Dispatch(conn, packet);
         });
 
         LOG_INFO("GAME", "Game Server initialized successfully");
@@ -112,6 +151,10 @@ public:
             }
         }
 
+        // 네트워크를 먼저 멈춘다 - 남은 연결의 DISCONNECT 명령을 게임 루프가 계속 비워 줘야 한다
+        LOG_INFO("GAME", "Stopping Game Server...");
+        network_manager_.StopServer();
+
         // 게임 루프 종료
         LOG_INFO("GAME", "Stopping game loop...");
         game_running_ = false;
@@ -119,54 +162,108 @@ public:
             game_thread_.join();
         }
         LOG_INFO("GAME", "Game loop stopped");
-
-        LOG_INFO("GAME", "Stopping Game Server...");
-        network_manager_.StopServer();
         LOG_INFO("GAME", "Game Server stopped");
     }
 
 private:
-    struct PlayerSession {
+    // 플레이어 엔티티 컴포넌트 - 틱 루프는 위치/이동 열만 훑고, 주소 같은 정보는 별도 열에 둔다
+    struct PlayerPosition {
+        int32_t x, y;
+    };
+
+    struct PendingMoves {
+        std::vector<std::pair<int32_t, int32_t>> moves;  // 이번 틱에 받은 이동 (용량 재사용)
+        float step_budget = 0.0f;       // 지금 움직일 수 있는 타일 수 - 틱마다 차고 최대 1초 분량까지 쌓인다
+        uint64_t budget_tick = 0;       // 마지막으로 예산을 채운 틱
+    };
+
+    struct PlayerLink {
+        std::shared_ptr<Network::Connection> connection;
+    };
+
+    struct PlayerInfo {
         uint32_t player_id;
         std::string address;
-        int32_t x, y;
+    };
+
+    using PlayerStore = Common::EntityStore<PlayerPosition, PendingMoves, PlayerLink, PlayerInfo>;
+
+    // I/O 스레드가 디코딩해 게임 루프로 넘기는 명령
+    // 채팅 본문은 패킷 버퍼가 재사용되므로 풀 버퍼로 복사해 둔다.
+    struct GameCommand {
+        enum Kind : uint8_t {
+            NONE,
+            CONNECT,
+            DISCONNECT,
+            MOVE,
+            CHAT,
+            SNAPSHOT_ACK
+        };
+
+        Kind kind = NONE;
+        std::shared_ptr<Network::Connection> connection;
+        int32_t dx = 0;
+        int32_t dy = 0;
+        uint32_t sequence = 0;
+        Network::ByteBuffer text;
     };
 
     void GameLoop() {
         LOG_INFO_FORMAT("GAME", "Game loop running at %d TPS", game_tick_rate_);
 
-        const auto tick_duration = std::chrono::milliseconds(1000 / game_tick_rate_);
-        auto last_tick = std::chrono::steady_clock::now();
-        auto last_stats = std::chrono::steady_clock::now();
+        // 절대 데드라인 기반 고정 타임스텝 - 다음 데드라인까지 잠들고, 밀린 틱은 정책대로 처리
+        tick_scheduler_.Start();
+        int64_t last_stats = Common::NowNanos();
         uint64_t tick_count = 0;
 
         while (game_running_) {
-            auto current_time = std::chrono::steady_clock::now();
-            auto delta_time = std::chrono::duration_cast<std::chrono::milliseconds>(current_time - last_tick);
-
-            if (delta_time >= tick_duration) {
+            int ticks = tick_scheduler_.WaitForNextTick();
+            for (int i = 0; i < ticks && game_running_; ++i) {
+                tick_scheduler_.BeginTick();
                 UpdateGame();
+                tick_scheduler_.EndTick();
                 tick_count++;
-                last_tick = current_time;
             }
 
-            // 1분마다 통계 출력
-            auto stats_delta = std::chrono::duration_cast<std::chrono::seconds>(current_time - last_stats);
-            if (stats_delta.count() >= 60) {
-                double actual_tps = tick_count / stats_delta.count();
+            // 1분마다 통계 출력 - 주기 확인에는 ms 해상도 시각이면 충분하다
+            int64_t current_time = Common::NowNanos();
+            double stats_delta = (current_time - last_stats) / 1e9;
+            if (stats_delta >= 60) {
+                double actual_tps = tick_count / stats_delta;
                 LOG_DEBUG_FORMAT("GAME", "Game stats - Ticks: %llu, Actual TPS: %.2f",
-                               tick_count, actual_tps);
+                               static_cast<unsigned long long>(tick_count), actual_tps);
                 tick_count = 0;
                 last_stats = current_time;
             }
-
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
         }
 
         LOG_INFO("GAME", "Game loop exited");
     }
 
     void UpdateGame() {
+        {
+            std::lock_guard<std::mutex> lock(players_mutex_);
+
+            // 틱 시작 시 I/O 스레드가 쌓아둔 명령을 한 번에 처리
+            DrainInboundCommands();
+            ++game_tick_;
+            float speed = player_move_speed_.load(std::memory_order_relaxed);
+            float step_per_tick = speed / static_cast<float>(std::max(1, game_tick_rate_));
+
+            // 이동 적용과 결과 패킷 생성은 플레이어별로 독립적이므로 잡 시스템으로 나눠 실행
+            // ParallelFor가 반환되면 모든 조각이 끝난 상태 (틱 단위 결정적 합류)
+            // 이번 틱에 나간 플레이어의 핸들은 무효이므로 건너뛴다
+            job_system_.ParallelFor(moving_players_.size(), 0, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    size_t dense = players_.DenseIndex(moving_players_[i]);
+                    if (dense != Common::EntityHandle::kInvalidIndex) {
+                        IntegratePlayerMoves(dense, step_per_tick, speed);
+                    }
+                }
+            });
+            moving_players_.clear();
+        }
+
         // 20 TPS 게임 루프 - 현재는 기본적인 플레이어 관리만
         // 실제 게임에서는 플레이어 위치 동기화, 게임 로직 처리 등을 수행
 
@@ -180,72 +277,202 @@ private:
         }
     }
 
+    // 월드 상태를 캡처해 클라이언트마다 확인된 기준 대비 변경분만 보낸다
     void SynchronizePlayers() {
         std::lock_guard<std::mutex> lock(players_mutex_);
-        if (!player_sessions_.empty()) {
-            LOG_DEBUG_FORMAT("GAME", "Synchronizing %zu players", player_sessions_.size());
-            // 실제 동기화 로직이 여기에 들어갈 예정
+        if (players_.Empty()) {
+            return;
+        }
+
+        const auto& positions = players_.Column<PlayerPosition>();
+        const auto& infos = players_.Column<PlayerInfo>();
+        Network::WorldSnapshot state;
+        state.reserve(players_.Size());
+        for (size_t i = 0; i < players_.Size(); ++i) {
+            state.push_back(Network::EntitySnapshot{infos[i].player_id, positions[i].x, positions[i].y});
+        }
+        uint32_t sequence = snapshot_replicator_.Capture(std::move(state));
+
+        // 엔티티 상한을 넘으면 뒤쪽 id는 복제되지 않는다 - 매 틱 찍지 않고 시작/해소될 때만 알린다
+        size_t truncated = snapshot_replicator_.GetStats().truncated_entities;
+        if ((truncated > 0) != snapshot_truncated_) {
+            snapshot_truncated_ = truncated > 0;
+            if (snapshot_truncated_) {
+                LOG_WARNING_FORMAT("GAME", "Snapshot entity limit (%zu) exceeded - %zu players are not replicated",
+                                   Network::kMaxSnapshotEntities, truncated);
+            } else {
+                LOG_INFO("GAME", "Snapshot entity count back under the limit");
+            }
         }
+
+        const auto& links = players_.Column<PlayerLink>();
+        for (size_t i = 0; i < players_.Size(); ++i) {
+            if (Network::SharedFrame frame = snapshot_replicator_.BuildFrame(infos[i].player_id)) {
+                links[i].connection->SendFrame(frame);
+            }
+        }
+        LOG_DEBUG_FORMAT("GAME", "Snapshot %u sent to %zu players", sequence, players_.Size());
     }
 
-    void HandlePacket(std::shared_ptr<Network::Connection> conn, const Network::Packet& packet) {
-        LOG_DEBUG_FORMAT("GAME", "Received packet type %d from %s",
-                        packet.type, conn->GetAddress().c_str());
-
-        switch (packet.type) {
-            case Network::PACKET_ECHO: {
-                std::string message = "GAME_ECHO_RESPONSE";
-                auto response_data = Network::SerializeString(message);
-                Network::Packet response(Network::PACKET_ECHO, response_data);
-                network_manager_.SendToClient(conn, response);
-                LOG_DEBUG_FORMAT("GAME", "Echo request handled for %s", conn->GetAddress().c_str());
-                break;
+    // 핸들러는 I/O 스레드에서 실행된다 - 게임 상태를 건드리지 않고 명령만 큐에 넣는다
+    void RegisterHandlers() {
+        dispatcher_.Register<Network::EchoMessage>(
+            [this](const Network::PacketDispatcher::ConnectionPtr& conn, const Network::EchoMessage&) {
+                network_manager_.SendToClient(conn, Network::EncodePacket(Network::EchoMessage{"GAME_ECHO_RESPONSE"}));
+            });
+        dispatcher_.Register<Network::PlayerMoveRequest>(
+            [this](const Network::PacketDispatcher::ConnectionPtr& conn, const Network::PlayerMoveRequest& move) {
+                GameCommand command;
+                command.kind = GameCommand::MOVE;
+                command.connection = conn;
+                command.dx = move.dx;
+                command.dy = move.dy;
+                PushCommand(std::move(command));
+            });
+        dispatcher_.Register<Network::ChatMessage>(
+            [this](const Network::PacketDispatcher::ConnectionPtr& conn, const Network::ChatMessage& chat) {
+                GameCommand command;
+                command.kind = GameCommand::CHAT;
+                command.connection = conn;
+                command.text.assign(chat.message.begin(), chat.message.end());
+                PushCommand(std::move(command));
+            });
+        dispatcher_.Register<Network::SnapshotAck>(
+            [this](const Network::PacketDispatcher::ConnectionPtr& conn, const Network::SnapshotAck& ack) {
+                GameCommand command;
+                command.kind = GameCommand::SNAPSHOT_ACK;
+                command.connection = conn;
+                command.sequence = ack.sequence;
+                PushCommand(std::move(command));
+            });
+    }
+
+    // 패킷 명령은 큐가 가득 차면 버린다 (I/O 스레드를 막지 않는다)
+    void PushCommand(GameCommand&& command) {
+        if (!inbound_queue_.TryPush(std::move(command))) {
+            commands_dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // 접속/종료는 잃어버리면 세션이 어긋나므로 자리가 날 때까지 양보하며 재시도
+    // 게임 루프가 멈췄으면 큐를 비울 스레드가 없으므로 포기한다 (세션도 함께 사라진다)
+    void PushLifecycleCommand(GameCommand::Kind kind, const std::shared_ptr<Network::Connection>& conn) {
+        GameCommand command;
+        command.kind = kind;
+        command.connection = conn;
+        while (!inbound_queue_.TryPush(std::move(command))) {
+            if (!game_running_) {
+                commands_dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
             }
-            case Network::PACKET_PLAYER_MOVE: {
-                HandlePlayerMove(conn, packet);
+            std::this_thread::yield();
+        }
+    }
+
+    // 게임 루프 스레드에서 players_mutex_를 잡은 채로 호출
+    void DrainInboundCommands() {
+        // 한 틱에서 큐 용량 이상은 처리하지 않는다 - 생산이 계속되어도 틱이 끝나도록
+        GameCommand command;
+        size_t processed = 0;
+        while (processed < inbound_queue_.GetCapacity() && inbound_queue_.TryPop(command)) {
+            ExecuteCommand(command);
+            ++processed;
+        }
+        inbound_queue_.PublishHead();
+        commands_processed_ += processed;
+    }
+
+    void ExecuteCommand(const GameCommand& command) {
+        const auto& conn = command.connection;
+        switch (command.kind) {
+            case GameCommand::CONNECT:
+                player_handles_[conn->GetId()] = players_.Create(
+                    PlayerPosition{0, 0}, PendingMoves{}, PlayerLink{conn}, PlayerInfo{conn->GetId(), conn->GetAddress()});
+                snapshot_replicator_.AddClient(conn->GetId());
+                LOG_DEBUG_FORMAT("GAME", "Player session created for ID: %d", conn->GetId());
                 break;
-            }
-            case Network::PACKET_PLAYER_CHAT: {
-                HandlePlayerChat(conn, packet);
+            case GameCommand::DISCONNECT: {
+                auto it = player_handles_.find(conn->GetId());
+                if (it != player_handles_.end()) {
+                    players_.Destroy(it->second);
+                    player_handles_.erase(it);
+                }
+                snapshot_replicator_.RemoveClient(conn->GetId());
+                LOG_DEBUG_FORMAT("GAME", "Player session removed for ID: %d", conn->GetId());
                 break;
             }
+            case GameCommand::MOVE:
+                QueuePlayerMove(conn, command.dx, command.dy);
+                break;
+            case GameCommand::SNAPSHOT_ACK:
+                snapshot_replicator_.Acknowledge(conn->GetId(), command.sequence);
+                break;
+            case GameCommand::CHAT:
+                HandlePlayerChat(conn, std::string_view(reinterpret_cast<const char*>(command.text.data()),
+                                                        command.text.size()));
+                break;
             default:
-                LOG_WARNING_FORMAT("GAME", "Unknown packet type %d from %s",
-                                 packet.type, conn->GetAddress().c_str());
                 break;
         }
     }
 
-    void HandlePlayerMove(std::shared_ptr<Network::Connection> conn, const Network::Packet& packet) {
-        std::lock_guard<std::mutex> lock(players_mutex_);
-
-        if (player_sessions_.find(conn->GetId()) != player_sessions_.end()) {
-            // 실제로는 패킷에서 좌표를 파싱해야 함
-            auto& player = player_sessions_[conn->GetId()];
-            player.x += 1;
-            player.y += 1;
-
-            std::string move_response = "MOVE_SUCCESS";
-            auto response_data = Network::SerializeString(move_response);
-            Network::Packet response(Network::PACKET_PLAYER_MOVE, response_data);
-            network_manager_.SendToClient(conn, response);
+    void QueuePlayerMove(const std::shared_ptr<Network::Connection>& conn, int32_t dx, int32_t dy) {
+        auto it = player_handles_.find(conn->GetId());
+        if (it == player_handles_.end()) {
+            return;
+        }
 
-            LOG_DEBUG_FORMAT("GAME", "Player move: ID %d to (%d, %d)",
-                           conn->GetId(), player.x, player.y);
+        PendingMoves* pending = players_.Find<PendingMoves>(it->second);
+        if (pending->moves.empty()) {
+            moving_players_.push_back(it->second);
         }
+        pending->moves.emplace_back(dx, dy);
     }
 
-    void HandlePlayerChat(std::shared_ptr<Network::Connection> conn, const Network::Packet& packet) {
-        // 채팅 메시지 브로드캐스트
-        size_t offset = 0;
-        std::string chat_message = Network::DeserializeString(packet.data, offset);
-
-        LOG_INFO_FORMAT("GAME", "Chat from %s (ID: %d): %s",
-                       conn->GetAddress().c_str(), conn->GetId(), chat_message.c_str());
+    // 잡 워커에서 실행 - 자기 세션만 건드리고, 이동마다 결과를 순서대로 보낸다
+    // 이동량은 클라이언트 값이므로 이동 속도(player_move_speed)로 쌓인 예산만큼 축마다 잘라낸다.
+    // 잘린 결과도 그대로 보내 클라이언트가 서버 위치로 맞추게 한다.
+    void IntegratePlayerMoves(size_t dense, float step_per_tick, float max_budget) {
+        PlayerPosition& position = players_.Column<PlayerPosition>()[dense];
+        PendingMoves& pending = players_.Column<PendingMoves>()[dense];
+        const PlayerLink& link = players_.Column<PlayerLink>()[dense];
+        uint32_t player_id = link.connection->GetId();
+
+        pending.step_budget = std::min(max_budget, pending.step_budget +
+                                       static_cast<float>(game_tick_ - pending.budget_tick) * step_per_tick);
+        pending.budget_tick = game_tick_;
+
+        for (auto [dx, dy] : pending.moves) {
+            int32_t limit = static_cast<int32_t>(pending.step_budget);
+            dx = std::max(-limit, std::min(limit, dx));
+            dy = std::max(-limit, std::min(limit, dy));
+            pending.step_budget -= static_cast<float>(std::max(std::abs(dx), std::abs(dy)));
+            position.x += dx;
+            position.y += dy;
+
+            Network::PlayerMoveResult result{player_id, position.x, position.y};
+            network_manager_.SendToClient(link.connection, Network::EncodePacket(result));
+
+            LOG_DEBUG_FORMAT("GAME", "Player move: ID %d to (%d, %d)", player_id, position.x, position.y);
+        }
+        pending.moves.clear();
+    }
 
-        std::string broadcast_message = "CHAT_BROADCAST: " + chat_message;
-        auto response_data = Network::SerializeString(broadcast_message);
-        Network::Packet response(Network::PACKET_PLAYER_CHAT, response_data);
+    void HandlePlayerChat(const std::shared_ptr<Network::Connection>& conn, std::string_view chat_message) {
+        // 채팅 메시지 브로드캐스트 - 명령에 복사된 본문을 접두사와 함께 바로 기록
+
+        LOG_INFO_FORMAT("GAME", "Chat from %s (ID: %d): %.*s",
+                       conn->GetAddress().c_str(), conn->GetId(),
+                       static_cast<int>(chat_message.size()), chat_message.data());
+
+        // ChatMessage와 같은 레이아웃 (길이 접두사 + 문자열)을 두 조각으로 기록
+        constexpr std::string_view kPrefix = "CHAT_BROADCAST: ";
+        size_t length = std::min<size_t>(kPrefix.size() + chat_message.size(), UINT16_MAX);
+        Network::PacketWriter writer(sizeof(uint16_t) + length);
+        writer.WriteUInt16(static_cast<uint16_t>(length));
+        writer.WriteBytes(kPrefix.data(), kPrefix.size());
+        writer.WriteBytes(chat_message.data(), length - kPrefix.size());
+        Network::Packet response(Network::PACKET_PLAYER_CHAT, writer.Release());
         network_manager_.SendToAll(response);
     }
 
@@ -254,7 +481,7 @@ private:
         size_t session_count;
         {
             std::lock_guard<std::mutex> lock(players_mutex_);
-            session_count = player_sessions_.size();
+            session_count = players_.Size();
         }
 
         LOG_INFO("GAME", "=== Game Server Status ===");
@@ -265,15 +492,48 @@ private:
         LOG_INFO_FORMAT("GAME", "Target TPS: %d", game_tick_rate_);
         LOG_INFO_FORMAT("GAME", "Log Level: %s", log_level_.c_str());
         LOG_INFO_FORMAT("GAME", "Game Running: %s", game_running_ ? "Yes" : "No");
+        LOG_INFO_FORMAT("GAME", "Tick: %s", tick_scheduler_.GetStats().Describe().c_str());
+        {
+            std::lock_guard<std::mutex> lock(players_mutex_);
+            auto snapshot = snapshot_replicator_.GetStats();
+            LOG_INFO_FORMAT("GAME", "Snapshots: seq=%u clients=%zu full=%llu delta=%llu encoded=%llu bytes=%llu "
+                           "truncated=%llu (last %zu)",
+                           snapshot.sequence, snapshot.clients,
+                           static_cast<unsigned long long>(snapshot.full_frames),
+                           static_cast<unsigned long long>(snapshot.delta_frames),
+                           static_cast<unsigned long long>(snapshot.encoded_frames),
+                           static_cast<unsigned long long>(snapshot.bytes_sent),
+                           static_cast<unsigned long long>(snapshot.truncated_captures),
+                           snapshot.truncated_entities);
+        }
+        LOG_INFO_FORMAT("GAME", "Job Threads: %d, stolen=%llu", job_system_.GetWorkerCount(),
+                       static_cast<unsigned long long>(job_system_.GetStolenCount()));
+        LOG_INFO_FORMAT("GAME", "Inbound Queue: %zu/%zu, processed=%llu, dropped=%llu",
+                       inbound_queue_.ApproximateSize(), inbound_queue_.GetCapacity(),
+                       static_cast<unsigned long long>(commands_processed_.load()),
+                       static_cast<unsigned long long>(commands_dropped_.load()));
+        for (const auto& stats : dispatcher_.GetStats()) {
+            LOG_INFO_FORMAT("GAME", "Packet %s", stats.Describe().c_str());
+        }
+        LOG_INFO_FORMAT("GAME", "Unknown packets dropped: %llu (last type %u)",
+                       static_cast<unsigned long long>(dispatcher_.GetUnknownCount()),
+                       dispatcher_.GetLastUnknownType());
+        LOG_INFO_FORMAT("GAME", "Log mode: %s%s, dropped: %llu, rotations: %llu",
+                       Common::LogManager::Instance().IsAsync() ? "async" : "sync",
+                       Common::LogManager::Instance().IsBinary() ? " binary" : "",
+                       static_cast<unsigned long long>(Common::LogManager::Instance().GetDroppedCount()),
+                       static_cast<unsigned long long>(Common::LogManager::Instance().GetRotationCount()));
     }
 
     void PrintPlayers() {
         std::lock_guard<std::mutex> lock(players_mutex_);
-        LOG_INFO_FORMAT("GAME", "=== Active Players (%zu) ===", player_sessions_.size());
+        LOG_INFO_FORMAT("GAME", "=== Active Players (%zu) ===", players_.Size());
 
-        for (const auto& [id, session] : player_sessions_) {
+        const auto& positions = players_.Column<PlayerPosition>();
+        const auto& infos = players_.Column<PlayerInfo>();
+        for (size_t i = 0; i < players_.Size(); ++i) {
             LOG_INFO_FORMAT("GAME", "ID: %d, Address: %s, Pos: (%d, %d)",
-                           id, session.address.c_str(), session.x, session.y);
+                           infos[i].player_id, infos[i].address.c_str(), positions[i].x, positions[i].y);
         }
     }
 
@@ -282,6 +542,7 @@ private:
             int new_tps = std::stoi(tps_str);
             if (new_tps >= 1 && new_tps <= 100) {
                 game_tick_rate_ = new_tps;
+                tick_scheduler_.SetTickRate(new_tps);
                 LOG_INFO_FORMAT("GAME", "TPS changed to: %d", game_tick_rate_);
             } else {
                 LOG_WARNING("GAME", "TPS must be between 1 and 100");
@@ -304,9 +565,12 @@ private:
                     LOG_INFO_FORMAT("GAME", "Log level changed to: %s", log_level_.c_str());
                 }
 
+                player_move_speed_ = static_cast<float>(Common::GameServerConfig::GetPlayerMoveSpeed());
+
                 int new_tps = Common::GameServerConfig::GetTickRate();
                 if (new_tps != game_tick_rate_) {
                     game_tick_rate_ = new_tps;
+                    tick_scheduler_.SetTickRate(new_tps);
                     LOG_INFO_FORMAT("GAME", "TPS changed to: %d", game_tick_rate_);
                 }
 
@@ -330,14 +594,26 @@ private:
     }
 
     Network::NetworkManager network_manager_;
+    Network::PacketDispatcher dispatcher_;
     int port_;
     int max_connections_;
     int game_tick_rate_;
+    std::atomic<float> player_move_speed_;  // 초당 타일 - 콘솔 reload가 바꾼다
+    uint64_t game_tick_ = 0;                // players_mutex_ - 이동 예산 계산용 틱 번호
     std::string log_level_;
     std::atomic<bool> game_running_;
     std::thread game_thread_;
-    std::map<uint32_t, PlayerSession> player_sessions_;
-    std::mutex players_mutex_;
+    Common::TickScheduler tick_scheduler_;
+    Common::JobSystem job_system_;
+    Network::MpscQueue<GameCommand> inbound_queue_;
+    std::atomic<uint64_t> commands_processed_{0};
+    std::atomic<uint64_t> commands_dropped_{0};
+    PlayerStore players_;
+    std::unordered_map<uint32_t, Common::EntityHandle> player_handles_;  // 연결 ID -> 엔티티
+    std::vector<Common::EntityHandle> moving_players_;                   // 이번 틱에 이동 명령을 받은 엔티티
+    Network::SnapshotReplicator snapshot_replicator_;
+    bool snapshot_truncated_ = false;   // 게임 루프 스레드 전용 - 상한 초과 경고 상태
+    std::mutex players_mutex_;  // 게임 루프와 콘솔 명령 사이에서만 사용
 };
 
 int main() {
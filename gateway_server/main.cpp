@@ -1,6 +1,9 @@
 #include "../network/network_manager.h"
+#include "../network/packet_schema.h"
+#include "../network/packet_dispatcher.h"
 #include "../common/log_manager.h"
 #include "../common/config_manager.h"
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <chrono>
@@ -33,17 +36,39 @@ public:
         Common::LogManager::Instance().SetLogLevel(StringToLogLevel(log_level_));
         Common::LogManager::Instance().SetConsoleOutput(true);
         Common::LogManager::Instance().SetFileOutput(true, "logs/gateway_server.log");
+        Common::LogManager::Instance().SetAsyncMode(
+            Common::GatewayServerConfig::GetLogAsync(),
+            static_cast<size_t>(std::max(4, Common::GatewayServerConfig::GetLogBufferKb())) * 1024,
+            Common::ParseLogOverflowPolicy(Common::GatewayServerConfig::GetLogOverflowPolicy()),
+            std::chrono::milliseconds(Common::GatewayServerConfig::GetLogFlushIntervalMs()));
+        Common::LogRotationPolicy rotation;
+        rotation.max_file_bytes =
+            static_cast<uint64_t>(std::max(0, Common::GatewayServerConfig::GetLogRotateSizeMb())) << 20;
+        rotation.interval = std::chrono::minutes(std::max(0, Common::GatewayServerConfig::GetLogRotateIntervalMin()));
+        rotation.max_files = static_cast<size_t>(std::max(0, Common::GatewayServerConfig::GetLogRetainFiles()));
+        rotation.max_total_bytes =
+            static_cast<uint64_t>(std::max(0, Common::GatewayServerConfig::GetLogRetainTotalMb())) << 20;
+        rotation.compress = Common::GatewayServerConfig::GetLogCompress();
+        Common::LogManager::Instance().SetRotation(rotation);
+        if (Common::GatewayServerConfig::GetLogBinary()) {
+            Common::LogManager::Instance().SetBinaryOutput(true, Common::GatewayServerConfig::GetLogBinaryFile());
+        }
 
         LOG_INFO("GATEWAY", "Initializing Gateway Server...");
         LOG_INFO_FORMAT("GATEWAY", "Port: %d, Max Connections: %d", port_, max_connections_);
         LOG_INFO_FORMAT("GATEWAY", "Load Balance Method: %s",
                        Common::GatewayServerConfig::GetLoadBalanceMethod().c_str());
 
-        if (!network_manager_.InitializeServer(port_, max_connections_)) {
+        if (!network_manager_.InitializeServer(port_, max_connections_,
+                                              Common::GatewayServerConfig::GetIoThreads())) {
             LOG_ERROR_FORMAT("GATEWAY", "Failed to initialize Gateway Server on port %d", port_);
             return false;
         }
+        network_manager_.SetSendQueueLimit(
+            static_cast<size_t>(Common::GatewayServerConfig::GetSendQueueLimitKb()) * 1024,
+            Network::ParseSendOverflowPolicy(Common::GatewayServerConfig::GetSendOverflowPolicy()));
 
+        RegisterHandlers();
         SetupCallbacks();
         LOG_INFO("GATEWAY", "Gateway Server initialized successfully");
         return true;
@@ -70,10 +95,21 @@ private:
         });
 
         network_manager_.SetOnPacketReceived([this](std::shared_ptr<Network::Connection> conn, const Network::Packet& packet) {
-            HandlePacket(conn, packet);
+            dispatcher_.Dispatch(conn, packet);
         });
     }
 
+    void RegisterHandlers() {
+        dispatcher_.Register<Network::EchoMessage>(
+            [this](const Network::PacketDispatcher::ConnectionPtr& conn, const Network::EchoMessage&) {
+                network_manager_.SendToClient(conn, Network::EncodePacket(Network::EchoMessage{"GATEWAY_ECHO_RESPONSE"}));
+            });
+        dispatcher_.Register<Network::LoginRequest>(
+            [this](const Network::PacketDispatcher::ConnectionPtr& conn, const Network::LoginRequest& request) {
+                HandleLoginRequest(conn, request);
+            });
+    }
+
     void ProcessCommands() {
         std::string input;
         while (std::getline(std::cin, input)) {
@@ -92,27 +128,11 @@ private:
         }
     }
 
-    void HandlePacket(std::shared_ptr<Network::Connection> conn, const Network::Packet& packet) {
-        switch (packet.type) {
-            case Network::PACKET_ECHO: {
-                std::string message = "GATEWAY_ECHO_RESPONSE";
-                auto response_data = Network::SerializeString(message);
-                Network::Packet response(Network::PACKET_ECHO, response_data);
-                network_manager_.SendToClient(conn, response);
-                break;
-            }
-            case Network::PACKET_LOGIN_REQUEST: {
-                std::string login_response = "LOGIN_SUCCESS";
-                auto response_data = Network::SerializeString(login_response);
-                Network::Packet response(Network::PACKET_LOGIN_RESPONSE, response_data);
-                network_manager_.SendToClient(conn, response);
-                LOG_INFO_FORMAT("GATEWAY", "Login request from %s", conn->GetAddress().c_str());
-                break;
-            }
-            default:
-                LOG_WARNING_FORMAT("GATEWAY", "Unknown packet type: %d", packet.type);
-                break;
-        }
+    void HandleLoginRequest(const std::shared_ptr<Network::Connection>& conn, const Network::LoginRequest& request) {
+        Network::Packet response = Network::EncodePacket(Network::LoginResponse{"LOGIN_SUCCESS"});
+        network_manager_.SendToClient(conn, response);
+        LOG_INFO_FORMAT("GATEWAY", "Login request from %s (user: %.*s)", conn->GetAddress().c_str(),
+                       static_cast<int>(request.username.size()), request.username.data());
     }
 
     void PrintConfig() {
@@ -136,7 +156,17 @@ private:
     void PrintStatus() {
         LOG_INFO("GATEWAY", "=== Gateway Server Status ===");
         LOG_INFO_FORMAT("GATEWAY", "Current Connections: %d", network_manager_.GetConnectionCount());
-        // 추가 상태 정보...
+        for (const auto& stats : dispatcher_.GetStats()) {
+            LOG_INFO_FORMAT("GATEWAY", "Packet %s", stats.Describe().c_str());
+        }
+        LOG_INFO_FORMAT("GATEWAY", "Unknown packets dropped: %llu (last type %u)",
+                       static_cast<unsigned long long>(dispatcher_.GetUnknownCount()),
+                       dispatcher_.GetLastUnknownType());
+        LOG_INFO_FORMAT("GATEWAY", "Log mode: %s%s, dropped: %llu, rotations: %llu",
+                       Common::LogManager::Instance().IsAsync() ? "async" : "sync",
+                       Common::LogManager::Instance().IsBinary() ? " binary" : "",
+                       static_cast<unsigned long long>(Common::LogManager::Instance().GetDroppedCount()),
+                       static_cast<unsigned long long>(Common::LogManager::Instance().GetRotationCount()));
     }
 
     void PrintHelp() {
@@ -149,6 +179,7 @@ private:
     }
 
     Network::NetworkManager network_manager_;
+    Network::PacketDispatcher dispatcher_;
     int port_;
     int max_connections_;
     std::string log_level_;
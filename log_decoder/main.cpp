@@ -0,0 +1,117 @@
+// log_decoder/main.cpp - 바이너리 로그 디코더
+// LogManager 바이너리 모드(log_binary = true)가 남긴 파일을 텍스트 로그와 같은 줄 형식으로 바꾼다.
+//   LogDecoder <binary_log> [output]      output을 생략하면 표준 출력
+//   --sites                               줄 끝에 호출 지점(file:line)을 붙인다
+#include "../common/binary_log.h"
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+
+const char* LevelName(uint8_t level) {
+    switch (level) {
+        case 0:  return "DEBUG";
+        case 1:  return "INFO ";
+        case 2:  return "WARN ";
+        case 3:  return "ERROR";
+        case 4:  return "CRIT ";
+        default: return "UNKN ";
+    }
+}
+
+void PrintUsage() {
+    std::cerr << "Usage: LogDecoder [--sites] <binary_log> [output]" << std::endl;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    bool show_sites = false;
+    std::string input;
+    std::string output;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--sites") {
+            show_sites = true;
+        } else if (input.empty()) {
+            input = arg;
+        } else if (output.empty()) {
+            output = arg;
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+    if (input.empty()) {
+        PrintUsage();
+        return 1;
+    }
+
+    Common::BinaryLogReader reader;
+    if (!reader.Open(input)) {
+        std::cerr << "LogDecoder: " << reader.GetError() << std::endl;
+        return 1;
+    }
+
+    std::ofstream file;
+    if (!output.empty()) {
+        file.open(output, std::ios::out | std::ios::trunc);
+        if (!file.is_open()) {
+            std::cerr << "LogDecoder: cannot open " << output << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& out = output.empty() ? std::cout : file;
+
+    // 같은 초 안에서는 날짜/시각 부분을 다시 만들지 않는다
+    Common::BinaryLogReader::Event event;
+    int64_t cached_second = INT64_MIN;
+    char second_text[32] = {};
+    std::string line;
+    uint64_t count = 0;
+    while (reader.Next(event)) {
+        int64_t second = event.system_ns / 1000000000;
+        if (second != cached_second) {
+            std::time_t time = static_cast<std::time_t>(second);
+            std::tm tm;
+#ifdef _WIN32
+            localtime_s(&tm, &time);
+#else
+            localtime_r(&time, &tm);
+#endif
+            std::strftime(second_text, sizeof(second_text), "%Y-%m-%d %H:%M:%S", &tm);
+            cached_second = second;
+        }
+        char millis[8];
+        std::snprintf(millis, sizeof(millis), ".%03d", static_cast<int>(event.system_ns / 1000000 % 1000));
+
+        const Common::LogSiteInfo& site = *event.site;
+        line.clear();
+        line += '[';
+        line += second_text;
+        line += millis;
+        line += "] [";
+        line += LevelName(site.level);
+        line += "] [";
+        line += site.category;
+        line += "] ";
+        line += Common::FormatLogPayload(site, event.payload.data(), event.payload.size());
+        if (show_sites) {
+            line += "  (" + site.file + ":" + std::to_string(site.line) + ")";
+        }
+        line += '\n';
+        out.write(line.data(), static_cast<std::streamsize>(line.size()));
+        ++count;
+    }
+    out.flush();
+
+    if (!reader.GetError().empty()) {
+        // 서버가 쓰는 중이거나 비정상 종료로 끝이 잘린 파일 - 읽은 데까지는 출력했다
+        std::cerr << "LogDecoder: stopped after " << count << " records: " << reader.GetError() << std::endl;
+        return 2;
+    }
+    return 0;
+}
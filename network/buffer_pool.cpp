@@ -0,0 +1,186 @@
+// network/buffer_pool.cpp
+#include "buffer_pool.h"
+#include <atomic>
+#include <mutex>
+#include <new>
+
+namespace Network {
+
+namespace {
+
+// 스레드 로컬 캐시와 전역 보관소 사이에서 한 번에 옮기는 블록 수
+constexpr size_t kTransferBatch = 32;
+
+// 클래스별로 스레드 로컬/전역에 보관하는 최대 바이트 (블록 수는 최소 kTransferBatch 이상)
+constexpr size_t kLocalCacheBytes = 1024 * 1024;
+constexpr size_t kDepotBytes = 8 * 1024 * 1024;
+
+std::atomic<uint64_t> g_heap_allocations{0};
+std::atomic<uint64_t> g_heap_deallocations{0};
+
+constexpr size_t BlockSize(size_t index) {
+    return BufferPool::kMinBlockSize << index;
+}
+
+constexpr size_t MaxBlocks(size_t index, size_t budget_bytes) {
+    return budget_bytes / BlockSize(index) > kTransferBatch * 2
+        ? budget_bytes / BlockSize(index)
+        : kTransferBatch * 2;
+}
+
+void* HeapAllocate(size_t size) {
+    g_heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    return ::operator new(size);
+}
+
+void HeapDeallocate(void* block) {
+    g_heap_deallocations.fetch_add(1, std::memory_order_relaxed);
+    ::operator delete(block);
+}
+
+// 전역 보관소 - 스레드 간 교환은 묶음 단위라 락 경합이 드물다
+struct Depot {
+    std::mutex mutex;
+    std::vector<void*> blocks[BufferPool::kClassCount];
+
+    ~Depot() {
+        for (auto& list : blocks) {
+            for (void* block : list) {
+                ::operator delete(block);
+            }
+        }
+    }
+};
+
+Depot& GetDepot() {
+    static Depot depot;
+    return depot;
+}
+
+// 스레드 캐시가 이미 소멸된 뒤(정적 객체 소멸 등)의 호출은 힙으로 직접 보낸다
+thread_local bool t_cache_destroyed = false;
+
+// 스레드 로컬 캐시 - 할당/해제의 대부분은 여기서 락 없이 끝난다
+struct ThreadCache {
+    std::vector<void*> blocks[BufferPool::kClassCount];
+
+    ThreadCache() {
+        for (size_t i = 0; i < BufferPool::kClassCount; ++i) {
+            blocks[i].reserve(MaxBlocks(i, kLocalCacheBytes));
+        }
+    }
+
+    // 스레드 종료 시 남은 블록은 다른 스레드가 쓰도록 보관소로 돌려준다
+    ~ThreadCache() {
+        t_cache_destroyed = true;
+        Depot& depot = GetDepot();
+        std::lock_guard<std::mutex> lock(depot.mutex);
+        for (size_t i = 0; i < BufferPool::kClassCount; ++i) {
+            size_t limit = MaxBlocks(i, kDepotBytes);
+            for (void* block : blocks[i]) {
+                if (depot.blocks[i].size() < limit) {
+                    depot.blocks[i].push_back(block);
+                } else {
+                    HeapDeallocate(block);
+                }
+            }
+        }
+    }
+
+    // 보관소에서 한 묶음을 가져온다. 보관소도 비어있으면 false
+    bool Refill(size_t index) {
+        Depot& depot = GetDepot();
+        std::lock_guard<std::mutex> lock(depot.mutex);
+        auto& source = depot.blocks[index];
+        if (source.empty()) {
+            return false;
+        }
+        size_t count = source.size() < kTransferBatch ? source.size() : kTransferBatch;
+        blocks[index].insert(blocks[index].end(), source.end() - count, source.end());
+        source.resize(source.size() - count);
+        return true;
+    }
+
+    // 로컬 캐시가 가득 차면 한 묶음을 보관소로 넘긴다
+    void Drain(size_t index) {
+        auto& local = blocks[index];
+        size_t limit = MaxBlocks(index, kDepotBytes);
+        Depot& depot = GetDepot();
+        std::lock_guard<std::mutex> lock(depot.mutex);
+        for (size_t i = 0; i < kTransferBatch; ++i) {
+            void* block = local.back();
+            local.pop_back();
+            if (depot.blocks[index].size() < limit) {
+                depot.blocks[index].push_back(block);
+            } else {
+                HeapDeallocate(block);
+            }
+        }
+    }
+};
+
+ThreadCache& GetThreadCache() {
+    // 보관소를 먼저 생성해 스레드 캐시보다 늦게 소멸되도록 한다
+    GetDepot();
+    thread_local ThreadCache cache;
+    return cache;
+}
+
+} // anonymous namespace
+
+size_t BufferPool::SizeClassIndex(size_t size) {
+    size_t index = 0;
+    size_t block_size = kMinBlockSize;
+    while (block_size < size) {
+        block_size <<= 1;
+        ++index;
+    }
+    return index;
+}
+
+void* BufferPool::Allocate(size_t size) {
+    if (size > kMaxBlockSize || t_cache_destroyed) {
+        return HeapAllocate(size);
+    }
+
+    size_t index = SizeClassIndex(size);
+    ThreadCache& cache = GetThreadCache();
+    auto& local = cache.blocks[index];
+    if (local.empty() && !cache.Refill(index)) {
+        return HeapAllocate(BlockSize(index));
+    }
+
+    void* block = local.back();
+    local.pop_back();
+    return block;
+}
+
+void BufferPool::Deallocate(void* block, size_t size) {
+    if (block == nullptr) {
+        return;
+    }
+    if (size > kMaxBlockSize || t_cache_destroyed) {
+        HeapDeallocate(block);
+        return;
+    }
+
+    size_t index = SizeClassIndex(size);
+    ThreadCache& cache = GetThreadCache();
+    auto& local = cache.blocks[index];
+    if (local.size() >= MaxBlocks(index, kLocalCacheBytes)) {
+        cache.Drain(index);
+    }
+    local.push_back(block);
+}
+
+BufferPool::Stats BufferPool::GetStats() {
+    return {g_heap_allocations.load(std::memory_order_relaxed),
+            g_heap_deallocations.load(std::memory_order_relaxed)};
+}
+
+void BufferPool::ResetStats() {
+    g_heap_allocations = 0;
+    g_heap_deallocations = 0;
+}
+
+} // namespace Network
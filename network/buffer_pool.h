@@ -0,0 +1,61 @@
+// network/buffer_pool.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Network {
+
+// 크기 클래스별 버퍼 풀
+// 스레드마다 로컬 free list를 두고, 넘치거나 모자라면 전역 보관소(depot)와 묶음 단위로 교환한다.
+// 패킷 본문, 송신 프레임, 송신 큐 노드처럼 수명이 짧고 크기가 비슷한 할당을 재사용해
+// 정상 상태에서는 힙 할당이 일어나지 않도록 한다.
+class BufferPool {
+public:
+    static constexpr size_t kMinBlockSize = 64;
+    static constexpr size_t kMaxBlockSize = 128 * 1024;
+    static constexpr size_t kClassCount = 12;   // 64B ~ 128KB (2의 거듭제곱)
+
+    struct Stats {
+        uint64_t heap_allocations;    // 풀에서 충당하지 못해 힙에서 할당한 횟수
+        uint64_t heap_deallocations;  // 풀이 가득 차서 힙으로 반환한 횟수
+    };
+
+    static void* Allocate(size_t size);
+    static void Deallocate(void* block, size_t size);
+
+    static Stats GetStats();
+    static void ResetStats();
+
+private:
+    static size_t SizeClassIndex(size_t size);
+};
+
+// BufferPool을 사용하는 표준 할당자
+template<typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(BufferPool::Allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t count) noexcept {
+        BufferPool::Deallocate(pointer, count * sizeof(T));
+    }
+
+    template<typename U>
+    bool operator==(const PoolAllocator<U>&) const noexcept { return true; }
+    template<typename U>
+    bool operator!=(const PoolAllocator<U>&) const noexcept { return false; }
+};
+
+// 풀에서 할당되는 바이트 버퍼 - 패킷 본문과 프레임에 사용
+using ByteBuffer = std::vector<uint8_t, PoolAllocator<uint8_t>>;
+
+} // namespace Network
@@ -0,0 +1,102 @@
+// network/mpsc_queue.h
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace Network {
+
+// 고정 크기 링 버퍼 기반 lock-free 다중 생산자/단일 소비자 큐
+// 슬롯마다 시퀀스 번호를 두어 생산자는 tail을 CAS로 예약한 뒤 값을 기록하고 시퀀스를 게시한다.
+// 소비자는 한 스레드뿐이므로 head를 CAS 없이 전진시킨다.
+// 큐가 가득 차면 TryPush가 false를 반환한다 (생산자는 대기하지 않는다).
+template<typename T>
+class MpscQueue {
+public:
+    explicit MpscQueue(size_t capacity)
+        : capacity_(RoundUpToPowerOfTwo(capacity < 2 ? 2 : capacity))
+        , mask_(capacity_ - 1)
+        , slots_(new Slot[capacity_])
+        , head_(0)
+        , tail_(0) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    // 여러 스레드에서 동시에 호출 가능 - 실패하면 value는 그대로 남는다
+    bool TryPush(T&& value) {
+        size_t position = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[position & mask_];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    slot.value = std::move(value);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // 소비자 스레드 전용
+    bool TryPop(T& value) {
+        Slot& slot = slots_[head_ & mask_];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != head_ + 1) {
+            return false;
+        }
+        value = std::move(slot.value);
+        slot.value = T();   // 슬롯이 잡고 있는 자원(연결, 버퍼)을 바로 놓는다
+        slot.sequence.store(head_ + capacity_, std::memory_order_release);
+        ++head_;
+        return true;
+    }
+
+    // 대략적인 적재량 (통계용)
+    size_t ApproximateSize() const {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t head = head_published_.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    // 소비자가 한 배치를 마친 뒤 호출 - ApproximateSize가 참조하는 head를 게시한다
+    void PublishHead() { head_published_.store(head_, std::memory_order_relaxed); }
+
+    size_t GetCapacity() const { return capacity_; }
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    static size_t RoundUpToPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+    alignas(64) size_t head_;                    // 소비자 전용
+    std::atomic<size_t> head_published_{0};
+    alignas(64) std::atomic<size_t> tail_;
+};
+
+} // namespace Network
@@ -1,41 +1,167 @@
 #include "network_manager.h"
+#include "recv_buffer.h"
 #include <iostream>
 #include <algorithm>
 #include <cstring>
+#include <cerrno>
+
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+    #include <sys/eventfd.h>
+    #include <sys/uio.h>
+#endif
 
 namespace Network {
 
+namespace {
+#ifdef __linux__
+constexpr int kEpollTimeoutMs = 100;
+constexpr int kMaxEpollEvents = 256;
+constexpr int kMaxIovecs = 64;
+constexpr uint32_t kConnectionEvents = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+
+size_t DefaultIoThreadCount() {
+    unsigned int cores = std::thread::hardware_concurrency();
+    return std::max(1u, std::min(4u, cores));
+}
+#endif
+
+SOCKET CreateListenSocket(int port, int backlog, bool reuse_port) {
+    SOCKET listen_socket = socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_socket == INVALID_SOCKET) {
+        std::cerr << "Failed to create server socket" << std::endl;
+        return INVALID_SOCKET;
+    }
+
+    // 소켓 옵션 설정
+    int opt = 1;
+    setsockopt(listen_socket, SOL_SOCKET, SO_REUSEADDR,
+               reinterpret_cast<const char*>(&opt), sizeof(opt));
+
+#ifdef __linux__
+    if (reuse_port) {
+        if (setsockopt(listen_socket, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt)) == -1) {
+            std::cerr << "Failed to enable SO_REUSEPORT on server socket" << std::endl;
+            closesocket(listen_socket);
+            return INVALID_SOCKET;
+        }
+        int flags = fcntl(listen_socket, F_GETFL, 0);
+        fcntl(listen_socket, F_SETFL, flags | O_NONBLOCK);
+    }
+#else
+    (void)reuse_port;
+#endif
+
+    // 바인드
+    sockaddr_in server_addr{};
+    server_addr.sin_family = AF_INET;
+    server_addr.sin_addr.s_addr = INADDR_ANY;
+    server_addr.sin_port = htons(port);
+
+    if (bind(listen_socket, reinterpret_cast<sockaddr*>(&server_addr),
+             sizeof(server_addr)) == SOCKET_ERROR) {
+        std::cerr << "Failed to bind server socket" << std::endl;
+        closesocket(listen_socket);
+        return INVALID_SOCKET;
+    }
+
+    // 리슨
+    if (listen(listen_socket, backlog) == SOCKET_ERROR) {
+        std::cerr << "Failed to listen on server socket" << std::endl;
+        closesocket(listen_socket);
+        return INVALID_SOCKET;
+    }
+
+    return listen_socket;
+}
+} // namespace
+
+// 헤더(타입 + 크기)와 본문을 하나의 연속된 프레임으로 인코딩
+SharedFrame EncodeFrame(const Packet& packet) {
+    uint16_t header[2] = { packet.type, packet.size };
+    const uint8_t* header_bytes = reinterpret_cast<const uint8_t*>(header);
+
+    auto frame = std::allocate_shared<ByteBuffer>(PoolAllocator<ByteBuffer>());
+    frame->reserve(sizeof(header) + packet.size);
+    frame->insert(frame->end(), header_bytes, header_bytes + sizeof(header));
+    frame->insert(frame->end(), packet.data.begin(), packet.data.begin() + packet.size);
+    return frame;
+}
+
 std::atomic<uint32_t> Connection::next_id_(1);
 
 Connection::Connection(SOCKET socket, const std::string& address)
-    : socket_(socket), address_(address), connected_(true) {
+    : socket_(socket), address_(address), connected_(true), non_blocking_(false)
+    , recv_buffer_(std::make_unique<RecvBuffer>())
+    , send_queue_offset_(0)
+    , queued_bytes_(0)
+    , send_queue_limit_(kDefaultSendQueueLimit)
+    , overflow_policy_(SendOverflowPolicy::DISCONNECT)
+    , flush_scheduled_(false)
+    , dropped_packets_(0) {
     id_ = next_id_.fetch_add(1);
 }
 
 Connection::~Connection() {
-    Disconnect();
+    Close();
 }
 
 bool Connection::Send(const Packet& packet) {
     if (!connected_) return false;
+    return SendFrame(EncodeFrame(packet));
+}
 
-    std::lock_guard<std::mutex> lock(send_mutex_);
+bool Connection::SendFrame(const SharedFrame& frame) {
+    if (!connected_) return false;
 
-    // 패킷 헤더 전송 (타입 + 크기)
-    uint16_t header[2] = { packet.type, packet.size };
-    int sent = send(socket_, reinterpret_cast<const char*>(header), sizeof(header), 0);
-    if (sent != sizeof(header)) {
-        connected_ = false;
-        return false;
+    if (!non_blocking_) {
+        return SendBlocking(*frame);
+    }
+
+    // 프레임을 큐에 넣기만 하고 실제 전송은 소유 리액터가 writev로 모아서 처리한다.
+    // 프레임은 공유 버퍼이므로 큐에는 참조만 추가된다.
+    bool schedule_flush = false;
+    {
+        std::lock_guard<std::mutex> lock(send_mutex_);
+        if (!connected_) return false;
+
+        if (queued_bytes_ + frame->size() > send_queue_limit_) {
+            if (overflow_policy_ == SendOverflowPolicy::DROP) {
+                dropped_packets_++;
+                return false;
+            }
+            Disconnect();
+            return false;
+        }
+
+        queued_bytes_ += frame->size();
+        send_queue_.push_back(frame);
+        schedule_flush = !flush_scheduled_.exchange(true);
+    }
+
+    if (schedule_flush && flush_requester_) {
+        flush_requester_(this);
     }
+    return true;
+}
+
+bool Connection::SendBlocking(const ByteBuffer& frame) {
+    std::lock_guard<std::mutex> lock(send_mutex_);
 
-    // 패킷 데이터 전송
-    if (packet.size > 0) {
-        sent = send(socket_, reinterpret_cast<const char*>(packet.data.data()), packet.size, 0);
-        if (sent != packet.size) {
+    // 헤더와 본문을 한 번에 전송, 부분 전송은 남은 부분을 이어서 보낸다
+    size_t offset = 0;
+    while (offset < frame.size()) {
+        int sent = send(socket_, reinterpret_cast<const char*>(frame.data() + offset),
+                        static_cast<int>(frame.size() - offset), 0);
+        if (sent <= 0) {
+            if (sent < 0 && errno == EINTR) {
+                continue;
+            }
             connected_ = false;
             return false;
         }
+        offset += static_cast<size_t>(sent);
     }
 
     return true;
@@ -46,22 +172,15 @@ bool Connection::Receive(Packet& packet) {
 
     std::lock_guard<std::mutex> lock(recv_mutex_);
 
-    // 패킷 헤더 수신
-    uint16_t header[2];
-    int received = recv(socket_, reinterpret_cast<char*>(header), sizeof(header), 0);
-    if (received != sizeof(header)) {
-        connected_ = false;
-        return false;
-    }
-
-    packet.type = header[0];
-    packet.size = header[1];
-
-    // 패킷 데이터 수신
-    if (packet.size > 0) {
-        packet.data.resize(packet.size);
-        received = recv(socket_, reinterpret_cast<char*>(packet.data.data()), packet.size, 0);
-        if (received != packet.size) {
+    // 이전 수신에서 남은 프레임이 있으면 시스템 콜 없이 반환하고,
+    // 부족하면 프레임이 완성될 때까지 읽는다 (짧은 읽기는 정상 상황)
+    while (!recv_buffer_->ExtractPacket(packet)) {
+        bool buffer_filled = false;
+        long received = recv_buffer_->ReadFrom(socket_, buffer_filled);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
             connected_ = false;
             return false;
         }
@@ -73,23 +192,173 @@ bool Connection::Receive(Packet& packet) {
 void Connection::Disconnect() {
     if (connected_.exchange(false)) {
         if (socket_ != INVALID_SOCKET) {
+#ifdef __linux__
+            if (non_blocking_) {
+                // 리액터 모드에서는 소유한 I/O 스레드가 소켓을 닫도록 종료만 통지
+                shutdown(socket_, SHUT_RDWR);
+                return;
+            }
+#endif
             closesocket(socket_);
             socket_ = INVALID_SOCKET;
         }
     }
 }
 
+void Connection::Close() {
+    Disconnect();
+
+    std::lock_guard<std::mutex> lock(send_mutex_);
+    if (socket_ != INVALID_SOCKET) {
+        closesocket(socket_);
+        socket_ = INVALID_SOCKET;
+    }
+    send_queue_.clear();
+    send_queue_offset_ = 0;
+    queued_bytes_ = 0;
+}
+
+void Connection::SetSendQueueLimit(size_t max_bytes, SendOverflowPolicy policy) {
+    std::lock_guard<std::mutex> lock(send_mutex_);
+    send_queue_limit_ = max_bytes;
+    overflow_policy_ = policy;
+}
+
+void Connection::SetFlushRequester(std::function<void(Connection*)> requester) {
+    std::lock_guard<std::mutex> lock(send_mutex_);
+    flush_requester_ = std::move(requester);
+}
+
+size_t Connection::GetQueuedBytes() const {
+    std::lock_guard<std::mutex> lock(send_mutex_);
+    return queued_bytes_;
+}
+
+bool Connection::SetNonBlocking() {
+#ifdef __linux__
+    int flags = fcntl(socket_, F_GETFL, 0);
+    if (flags == -1 || fcntl(socket_, F_SETFL, flags | O_NONBLOCK) == -1) {
+        return false;
+    }
+    non_blocking_ = true;
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool Connection::ReadPackets(std::vector<Packet>& packets, bool peer_closing) {
+#ifdef __linux__
+    std::lock_guard<std::mutex> lock(recv_mutex_);
+
+    // 에지 트리거 모드 - 준비된 공간을 다 채우지 못할 때까지 읽는다.
+    // 짧은 읽기는 소켓이 비었다는 뜻이므로 추가 EAGAIN 시스템 콜을 생략한다.
+    // 단, 마지막 데이터와 FIN이 한 에지로 오면 다음 에지가 없으므로 종료 이벤트에서는 EOF까지 읽는다.
+    bool peer_open = true;
+    while (true) {
+        bool buffer_filled = false;
+        long received = recv_buffer_->ReadFrom(socket_, buffer_filled);
+        if (received > 0) {
+            if (buffer_filled || peer_closing) {
+                continue;
+            }
+            break;
+        }
+        if (received == 0) {
+            peer_open = false;
+        } else if (errno == EINTR) {
+            continue;
+        } else if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            peer_open = false;
+        }
+        break;
+    }
+
+    // 한 번에 읽은 바이트에서 완성된 프레임을 모두 추출
+    Packet packet;
+    while (recv_buffer_->ExtractPacket(packet)) {
+        packets.push_back(std::move(packet));
+        packet = Packet();
+    }
+
+    if (!peer_open) {
+        connected_ = false;
+    }
+    return peer_open;
+#else
+    (void)packets;
+    (void)peer_closing;
+    return false;
+#endif
+}
+
+bool Connection::FlushPendingSends() {
+#ifdef __linux__
+    std::lock_guard<std::mutex> lock(send_mutex_);
+    if (socket_ == INVALID_SOCKET) {
+        return false;
+    }
+
+    // 쌓인 프레임들을 iovec으로 묶어 한 번의 sendmsg로 전송
+    while (!send_queue_.empty()) {
+        iovec vec[kMaxIovecs];
+        int count = 0;
+        for (auto it = send_queue_.begin(); it != send_queue_.end() && count < kMaxIovecs; ++it) {
+            size_t skip = (count == 0) ? send_queue_offset_ : 0;
+            vec[count].iov_base = const_cast<uint8_t*>((*it)->data()) + skip;
+            vec[count].iov_len = (*it)->size() - skip;
+            count++;
+        }
+
+        msghdr message{};
+        message.msg_iov = vec;
+        message.msg_iovlen = count;
+
+        ssize_t sent = sendmsg(socket_, &message, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                // 남은 데이터는 다음 EPOLLOUT 에지에서 이어서 전송
+                return true;
+            }
+            Disconnect();
+            return false;
+        }
+
+        // 전송된 만큼 큐 앞쪽 프레임 제거
+        size_t remaining = static_cast<size_t>(sent);
+        queued_bytes_ -= remaining;
+        while (remaining > 0) {
+            size_t front_left = send_queue_.front()->size() - send_queue_offset_;
+            if (remaining < front_left) {
+                send_queue_offset_ += remaining;
+                break;
+            }
+            remaining -= front_left;
+            send_queue_.pop_front();
+            send_queue_offset_ = 0;
+        }
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
 NetworkManager::NetworkManager()
     : server_socket_(INVALID_SOCKET)
     , server_running_(false)
     , shutdown_requested_(false)
+    , connections_(std::make_shared<ConnectionList>())
     , max_connections_(1000)
-    , server_port_(0) {
+    , server_port_(0)
+    , send_queue_limit_(kDefaultSendQueueLimit)
+    , send_overflow_policy_(SendOverflowPolicy::DISCONNECT) {
 #ifdef _WIN32
     WSADATA wsaData;
     wsa_initialized_ = (WSAStartup(MAKEWORD(2, 2), &wsaData) == 0);
-#elif __linux__
-    epoll_fd_ = epoll_create1(0);
 #elif __APPLE__
     kqueue_fd_ = kqueue();
 #endif
@@ -103,9 +372,7 @@ NetworkManager::~NetworkManager() {
         WSACleanup();
     }
 #elif __linux__
-    if (epoll_fd_ != -1) {
-        close(epoll_fd_);
-    }
+    CloseIoLoops();
 #elif __APPLE__
     if (kqueue_fd_ != -1) {
         close(kqueue_fd_);
@@ -113,45 +380,57 @@ NetworkManager::~NetworkManager() {
 #endif
 }
 
-bool NetworkManager::InitializeServer(int port, int max_connections) {
+bool NetworkManager::InitializeServer(int port, int max_connections, int io_threads) {
     server_port_ = port;
     max_connections_ = max_connections;
 
-    server_socket_ = socket(AF_INET, SOCK_STREAM, 0);
-    if (server_socket_ == INVALID_SOCKET) {
-        std::cerr << "Failed to create server socket" << std::endl;
-        return false;
-    }
-
-    // 소켓 옵션 설정
-    int opt = 1;
-    setsockopt(server_socket_, SOL_SOCKET, SO_REUSEADDR,
-               reinterpret_cast<const char*>(&opt), sizeof(opt));
-
-    // 바인드
-    sockaddr_in server_addr{};
-    server_addr.sin_family = AF_INET;
-    server_addr.sin_addr.s_addr = INADDR_ANY;
-    server_addr.sin_port = htons(port);
+#ifdef __linux__
+    // 리액터마다 SO_REUSEPORT 리슨 소켓을 따로 열어 커널이 연결을 분산하도록 한다
+    size_t loop_count = io_threads > 0 ? static_cast<size_t>(io_threads) : DefaultIoThreadCount();
+    unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+
+    for (size_t i = 0; i < loop_count; ++i) {
+        auto loop = std::make_unique<IoLoop>();
+        loop->cpu = static_cast<int>(i % cores);
+        loop->listen_socket = CreateListenSocket(port, max_connections, true);
+        if (loop->listen_socket == INVALID_SOCKET) {
+            CloseIoLoops();
+            return false;
+        }
 
-    if (bind(server_socket_, reinterpret_cast<sockaddr*>(&server_addr),
-             sizeof(server_addr)) == SOCKET_ERROR) {
-        std::cerr << "Failed to bind server socket" << std::endl;
-        closesocket(server_socket_);
-        server_socket_ = INVALID_SOCKET;
-        return false;
+        loop->epoll_fd = epoll_create1(0);
+        loop->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        epoll_event listen_event{};
+        listen_event.events = EPOLLIN;
+        listen_event.data.ptr = nullptr;
+        epoll_event wake_event{};
+        wake_event.events = EPOLLIN;
+        wake_event.data.ptr = loop.get();
+        if (loop->epoll_fd == -1 || loop->wake_fd == -1 ||
+            epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, loop->listen_socket, &listen_event) == -1 ||
+            epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, loop->wake_fd, &wake_event) == -1) {
+            std::cerr << "Failed to create epoll loop" << std::endl;
+            io_loops_.push_back(std::move(loop));
+            CloseIoLoops();
+            return false;
+        }
+        io_loops_.push_back(std::move(loop));
     }
+    server_socket_ = io_loops_.front()->listen_socket;
 
-    // 리슨
-    if (listen(server_socket_, max_connections) == SOCKET_ERROR) {
-        std::cerr << "Failed to listen on server socket" << std::endl;
-        closesocket(server_socket_);
-        server_socket_ = INVALID_SOCKET;
+    std::cout << "Server initialized on port " << port
+              << " (" << loop_count << " reactors, SO_REUSEPORT)" << std::endl;
+    return true;
+#else
+    (void)io_threads;
+    server_socket_ = CreateListenSocket(port, max_connections, false);
+    if (server_socket_ == INVALID_SOCKET) {
         return false;
     }
 
     std::cout << "Server initialized on port " << port << std::endl;
     return true;
+#endif
 }
 
 bool NetworkManager::InitializeClient() {
@@ -208,8 +487,23 @@ void NetworkManager::StartServer() {
     server_running_ = true;
     shutdown_requested_ = false;
 
+#ifdef __linux__
+    for (auto& loop : io_loops_) {
+        loop->thread = std::thread(&NetworkManager::IoLoopThread, this, loop.get());
+
+        // 각 리액터를 코어에 고정해 캐시 지역성을 유지
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(loop->cpu, &cpu_set);
+        pthread_setaffinity_np(loop->thread.native_handle(), sizeof(cpu_set), &cpu_set);
+    }
+
+    std::cout << "Server started on port " << server_port_
+              << " (epoll reactor, " << io_loops_.size() << " I/O threads)" << std::endl;
+#else
     server_thread_ = std::thread(&NetworkManager::ServerThread, this);
     std::cout << "Server started on port " << server_port_ << std::endl;
+#endif
 }
 
 void NetworkManager::StopServer() {
@@ -218,6 +512,9 @@ void NetworkManager::StopServer() {
     shutdown_requested_ = true;
     server_running_ = false;
 
+#ifdef __linux__
+    StopIoLoops();
+#else
     // 서버 소켓 닫기
     if (server_socket_ != INVALID_SOCKET) {
         closesocket(server_socket_);
@@ -225,12 +522,14 @@ void NetworkManager::StopServer() {
     }
 
     // 모든 클라이언트 연결 해제
+    std::shared_ptr<const ConnectionList> connections;
     {
         std::lock_guard<std::mutex> lock(connections_mutex_);
-        for (auto& conn : connections_) {
-            conn->Disconnect();
-        }
-        connections_.clear();
+        connections = connections_;
+        connections_ = std::make_shared<ConnectionList>();
+    }
+    for (auto& conn : *connections) {
+        conn->Disconnect();
     }
 
     // 스레드 종료 대기
@@ -244,6 +543,7 @@ void NetworkManager::StopServer() {
         }
     }
     client_threads_.clear();
+#endif
 
     std::cout << "Server stopped" << std::endl;
 }
@@ -277,10 +577,7 @@ void NetworkManager::ServerThread() {
         // 새 연결 생성
         auto connection = std::make_shared<Connection>(client_socket, client_address);
 
-        {
-            std::lock_guard<std::mutex> lock(connections_mutex_);
-            connections_.push_back(connection);
-        }
+        AddConnection(connection);
 
         // 클라이언트 핸들러 스레드 시작
         client_threads_.emplace_back(&NetworkManager::ClientHandlerThread, this, connection);
@@ -312,15 +609,184 @@ void NetworkManager::ClientHandlerThread(std::shared_ptr<Connection> connection)
     connection->Disconnect();
 
     // 연결 목록에서 제거
+    RemoveConnection(connection);
+
+    // 연결 해제 콜백 호출
+    if (on_client_disconnected_) {
+        on_client_disconnected_(connection);
+    }
+
+    std::cout << "Client disconnected: " << connection->GetAddress()
+              << " (ID: " << connection->GetId() << ")" << std::endl;
+}
+
+#ifdef __linux__
+void NetworkManager::AcceptConnections(IoLoop* loop) {
+    while (true) {
+        sockaddr_in client_addr{};
+        socklen_t client_addr_len = sizeof(client_addr);
+
+        SOCKET client_socket = accept4(loop->listen_socket,
+                                       reinterpret_cast<sockaddr*>(&client_addr),
+                                       &client_addr_len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (client_socket == INVALID_SOCKET) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                std::cerr << "Accept failed" << std::endl;
+            }
+            return;
+        }
+
+        if (GetConnectionCount() >= max_connections_) {
+            closesocket(client_socket);
+            continue;
+        }
+
+        char client_ip[INET_ADDRSTRLEN];
+        inet_ntop(AF_INET, &client_addr.sin_addr, client_ip, INET_ADDRSTRLEN);
+        std::string client_address = std::string(client_ip) + ":" +
+                                   std::to_string(ntohs(client_addr.sin_port));
+
+        auto connection = std::make_shared<Connection>(client_socket, client_address);
+        connection->SetNonBlocking();
+        connection->SetSendQueueLimit(send_queue_limit_, send_overflow_policy_);
+        connection->SetFlushRequester([this, loop](Connection* conn) {
+            RequestFlush(loop, conn);
+        });
+
+        AddConnection(connection);
+
+        // 연결 콜백은 이벤트 등록 전에 호출해 첫 패킷보다 먼저 실행되도록 보장
+        if (on_client_connected_) {
+            on_client_connected_(connection);
+        }
+
+        // 이 리스너로 들어온 연결은 같은 리액터가 끝까지 처리한다
+        epoll_event event{};
+        event.events = kConnectionEvents;
+        event.data.ptr = connection.get();
+        if (epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, client_socket, &event) == -1) {
+            std::cerr << "Failed to register client socket with epoll" << std::endl;
+            connection->Disconnect();
+            RemoveConnection(connection);
+            if (on_client_disconnected_) {
+                on_client_disconnected_(connection);
+            }
+            continue;
+        }
+
+        std::cout << "Client connected: " << client_address
+                  << " (ID: " << connection->GetId() << ")" << std::endl;
+    }
+}
+
+void NetworkManager::IoLoopThread(IoLoop* loop) {
+    epoll_event events[kMaxEpollEvents];
+
+    while (!shutdown_requested_) {
+        int count = epoll_wait(loop->epoll_fd, events, kMaxEpollEvents, kEpollTimeoutMs);
+        if (count < 0) {
+            if (errno != EINTR) {
+                std::cerr << "epoll_wait failed in I/O loop" << std::endl;
+            }
+            continue;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            if (events[i].data.ptr == nullptr) {
+                AcceptConnections(loop);
+                continue;
+            }
+            if (events[i].data.ptr == loop) {
+                uint64_t value;
+                while (read(loop->wake_fd, &value, sizeof(value)) > 0) {}
+                continue;
+            }
+            HandleConnectionEvent(loop, static_cast<Connection*>(events[i].data.ptr),
+                                  events[i].events);
+        }
+
+        // 이번 반복에서 쌓인 응답들을 연결별로 한 번에 전송
+        FlushPendingConnections(loop);
+    }
+}
+
+void NetworkManager::RequestFlush(IoLoop* loop, Connection* connection) {
     {
-        std::lock_guard<std::mutex> lock(connections_mutex_);
-        connections_.erase(
-            std::remove(connections_.begin(), connections_.end(), connection),
-            connections_.end()
-        );
+        std::lock_guard<std::mutex> lock(loop->pending_mutex);
+        loop->pending_flush.push_back(connection->shared_from_this());
     }
 
-    // 연결 해제 콜백 호출
+    // 리액터 스레드 자신이 보낸 경우 반복이 끝날 때 플러시되므로 깨울 필요가 없다
+    if (std::this_thread::get_id() != loop->thread.get_id()) {
+        uint64_t value = 1;
+        ssize_t written = write(loop->wake_fd, &value, sizeof(value));
+        (void)written;
+    }
+}
+
+void NetworkManager::FlushPendingConnections(IoLoop* loop) {
+    // 두 벡터를 맞바꿔 쓰므로 용량이 유지되어 반복마다 할당하지 않는다
+    auto& pending = loop->flush_batch;
+    {
+        std::lock_guard<std::mutex> lock(loop->pending_mutex);
+        if (loop->pending_flush.empty()) {
+            return;
+        }
+        pending.swap(loop->pending_flush);
+    }
+
+    for (auto& connection : pending) {
+        connection->ClearFlushScheduled();
+        if (connection->IsConnected()) {
+            // 실패 시 소켓이 shutdown되어 다음 이벤트에서 정리된다
+            connection->FlushPendingSends();
+        }
+    }
+    pending.clear();
+}
+
+void NetworkManager::HandleConnectionEvent(IoLoop* loop, Connection* connection, uint32_t events) {
+    // 연결은 이 루프에서만 목록에서 제거되므로 여기서는 포인터가 항상 유효하다
+    auto shared_connection = connection->shared_from_this();
+    bool closing = false;
+
+    if (events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+        auto& packets = loop->packet_batch;
+        packets.clear();
+        bool peer_closing = (events & (EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0;
+        if (!connection->ReadPackets(packets, peer_closing)) {
+            closing = true;
+        }
+
+        for (const auto& packet : packets) {
+            if (on_packet_received_) {
+                on_packet_received_(shared_connection, packet);
+            }
+        }
+    }
+
+    if (!closing && (events & EPOLLOUT) && connection->GetQueuedBytes() > 0) {
+        if (!connection->FlushPendingSends()) {
+            closing = true;
+        }
+    }
+
+    if (closing || !connection->IsConnected()) {
+        CloseConnection(loop, shared_connection);
+    }
+}
+
+void NetworkManager::CloseConnection(IoLoop* loop, std::shared_ptr<Connection> connection) {
+    if (connection->GetSocket() != INVALID_SOCKET) {
+        epoll_ctl(loop->epoll_fd, EPOLL_CTL_DEL, connection->GetSocket(), nullptr);
+    }
+    connection->Close();
+
+    RemoveConnection(connection);
+
     if (on_client_disconnected_) {
         on_client_disconnected_(connection);
     }
@@ -329,6 +795,53 @@ void NetworkManager::ClientHandlerThread(std::shared_ptr<Connection> connection)
               << " (ID: " << connection->GetId() << ")" << std::endl;
 }
 
+void NetworkManager::StopIoLoops() {
+    for (auto& loop : io_loops_) {
+        if (loop->thread.joinable()) {
+            loop->thread.join();
+        }
+    }
+
+    // I/O 스레드가 모두 종료된 뒤 남은 연결을 정리
+    std::shared_ptr<const ConnectionList> remaining;
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex_);
+        remaining = connections_;
+        connections_ = std::make_shared<ConnectionList>();
+    }
+
+    for (auto& connection : *remaining) {
+        connection->Close();
+        if (on_client_disconnected_) {
+            on_client_disconnected_(connection);
+        }
+    }
+
+    CloseIoLoops();
+    server_socket_ = INVALID_SOCKET;
+}
+
+void NetworkManager::CloseIoLoops() {
+    for (auto& loop : io_loops_) {
+        if (loop->listen_socket != INVALID_SOCKET) {
+            closesocket(loop->listen_socket);
+        }
+        if (loop->wake_fd != -1) {
+            close(loop->wake_fd);
+        }
+        if (loop->epoll_fd != -1) {
+            close(loop->epoll_fd);
+        }
+    }
+    io_loops_.clear();
+}
+#endif
+
+void NetworkManager::SetSendQueueLimit(size_t max_bytes, SendOverflowPolicy policy) {
+    send_queue_limit_ = max_bytes;
+    send_overflow_policy_ = policy;
+}
+
 void NetworkManager::SetOnClientConnected(std::function<void(std::shared_ptr<Connection>)> callback) {
     on_client_connected_ = callback;
 }
@@ -349,12 +862,30 @@ bool NetworkManager::SendToClient(std::shared_ptr<Connection> connection, const
 }
 
 bool NetworkManager::SendToAll(const Packet& packet) {
-    std::lock_guard<std::mutex> lock(connections_mutex_);
+    // 프레임은 한 번만 인코딩하고, 목록 스냅샷을 잡은 뒤 락 밖에서 각 큐에 참조만 추가
+    SharedFrame frame = EncodeFrame(packet);
+    auto connections = GetConnectionSnapshot();
     bool success = true;
 
-    for (auto& connection : connections_) {
+    for (auto& connection : *connections) {
         if (connection->IsConnected()) {
-            if (!connection->Send(packet)) {
+            if (!connection->SendFrame(frame)) {
+                success = false;
+            }
+        }
+    }
+
+    return success;
+}
+
+bool NetworkManager::SendToGroup(const std::vector<std::shared_ptr<Connection>>& connections, const Packet& packet) {
+    // SendToAll과 같이 한 번 인코딩한 프레임을 수신자들이 공유한다
+    SharedFrame frame = EncodeFrame(packet);
+    bool success = true;
+
+    for (const auto& connection : connections) {
+        if (connection && connection->IsConnected()) {
+            if (!connection->SendFrame(frame)) {
                 success = false;
             }
         }
@@ -364,65 +895,75 @@ bool NetworkManager::SendToAll(const Packet& packet) {
 }
 
 std::vector<std::shared_ptr<Connection>> NetworkManager::GetConnections() const {
-    std::lock_guard<std::mutex> lock(connections_mutex_);
-    return connections_;
+    return *GetConnectionSnapshot();
 }
 
 int NetworkManager::GetConnectionCount() const {
-    std::lock_guard<std::mutex> lock(connections_mutex_);
-    return static_cast<int>(connections_.size());
+    return static_cast<int>(GetConnectionSnapshot()->size());
 }
 
-// 유틸리티 함수 구현
-std::vector<uint8_t> SerializeString(const std::string& str) {
-    std::vector<uint8_t> data;
-    uint16_t length = static_cast<uint16_t>(str.length());
-
-    data.push_back(length & 0xFF);
-    data.push_back((length >> 8) & 0xFF);
+void NetworkManager::AddConnection(const std::shared_ptr<Connection>& connection) {
+    std::lock_guard<std::mutex> lock(connections_mutex_);
+    auto updated = std::make_shared<ConnectionList>(*connections_);
+    updated->push_back(connection);
+    connections_ = std::move(updated);
+}
 
-    for (char c : str) {
-        data.push_back(static_cast<uint8_t>(c));
+void NetworkManager::RemoveConnection(const std::shared_ptr<Connection>& connection) {
+    std::lock_guard<std::mutex> lock(connections_mutex_);
+    auto updated = std::make_shared<ConnectionList>();
+    updated->reserve(connections_->size());
+    for (const auto& existing : *connections_) {
+        if (existing != connection) {
+            updated->push_back(existing);
+        }
     }
-
-    return data;
+    connections_ = std::move(updated);
 }
 
-std::string DeserializeString(const std::vector<uint8_t>& data, size_t& offset) {
-    if (offset + 2 > data.size()) return "";
-
-    uint16_t length = data[offset] | (data[offset + 1] << 8);
-    offset += 2;
+std::shared_ptr<const NetworkManager::ConnectionList> NetworkManager::GetConnectionSnapshot() const {
+    std::lock_guard<std::mutex> lock(connections_mutex_);
+    return connections_;
+}
 
-    if (offset + length > data.size()) return "";
+// 유틸리티 함수 구현
+ByteBuffer SerializeString(const std::string& str) {
+    PacketWriter writer(sizeof(uint16_t) + str.size());
+    writer.WriteString(str);
+    return writer.Release();
+}
 
-    std::string str;
-    str.reserve(length);
+std::string DeserializeString(const ByteBuffer& data, size_t& offset) {
+    if (offset > data.size()) return "";
 
-    for (uint16_t i = 0; i < length; ++i) {
-        str.push_back(static_cast<char>(data[offset + i]));
-    }
+    PacketReader reader(data.data() + offset, data.size() - offset);
+    std::string_view str;
+    if (!reader.ReadString(str)) return "";
 
-    offset += length;
-    return str;
+    offset += reader.Offset();
+    return std::string(str);
 }
 
-void SerializeInt32(std::vector<uint8_t>& data, int32_t value) {
-    data.push_back(value & 0xFF);
-    data.push_back((value >> 8) & 0xFF);
-    data.push_back((value >> 16) & 0xFF);
-    data.push_back((value >> 24) & 0xFF);
+void SerializeInt32(ByteBuffer& data, int32_t value) {
+    int32_t encoded = Detail::ToLittleEndian(value);
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&encoded);
+    data.insert(data.end(), bytes, bytes + sizeof(encoded));
 }
 
-int32_t DeserializeInt32(const std::vector<uint8_t>& data, size_t& offset) {
-    if (offset + 4 > data.size()) return 0;
+int32_t DeserializeInt32(const ByteBuffer& data, size_t& offset) {
+    if (offset > data.size()) return 0;
+
+    PacketReader reader(data.data() + offset, data.size() - offset);
+    int32_t value;
+    if (!reader.ReadInt32(value)) return 0;
 
-    int32_t value = data[offset] |
-                   (data[offset + 1] << 8) |
-                   (data[offset + 2] << 16) |
-                   (data[offset + 3] << 24);
-    offset += 4;
+    offset += reader.Offset();
     return value;
 }
 
+SendOverflowPolicy ParseSendOverflowPolicy(const std::string& policy) {
+    if (policy == "drop") return SendOverflowPolicy::DROP;
+    return SendOverflowPolicy::DISCONNECT;
+}
+
 } // namespace Network
\ No newline at end of file
@@ -8,7 +8,9 @@
 #include <mutex>
 #include <atomic>
 #include <queue>
+#include <deque>
 #include <map>
+#include <cstdint>
 
 #ifdef _WIN32
     #include <winsock2.h>
@@ -33,23 +35,46 @@
     #define closesocket close
 #endif
 
+#include "buffer_pool.h"
+#include "packet_stream.h"
+
 namespace Network {
 
 struct Packet {
     uint16_t type;
     uint16_t size;
-    std::vector<uint8_t> data;
+    ByteBuffer data;    // 본문은 BufferPool에서 할당
 
     Packet() : type(0), size(0) {}
-    Packet(uint16_t t, const std::vector<uint8_t>& d) : type(t), size(d.size()), data(d) {}
+    Packet(uint16_t t, const ByteBuffer& d) : type(t), size(d.size()), data(d) {}
+    Packet(uint16_t t, ByteBuffer&& d) : type(t), size(d.size()), data(std::move(d)) {}
+    Packet(uint16_t t, const std::vector<uint8_t>& d) : type(t), size(d.size()), data(d.begin(), d.end()) {}
 };
 
-class Connection {
+class RecvBuffer;
+
+// 송신 큐가 상한(high-water mark)을 넘었을 때의 처리 방식
+enum class SendOverflowPolicy {
+    DISCONNECT,  // 배출하지 못하는 클라이언트 연결 종료
+    DROP         // 새 패킷을 버리고 카운트
+};
+
+constexpr size_t kDefaultSendQueueLimit = 1024 * 1024;
+
+// 인코딩이 끝난 불변 프레임 (헤더 + 본문)
+// 브로드캐스트 시 한 번만 직렬화하고 모든 수신자의 송신 큐가 같은 버퍼를 공유한다.
+// 제어 블록과 버퍼 모두 BufferPool에서 할당된다.
+using SharedFrame = std::shared_ptr<const ByteBuffer>;
+
+SharedFrame EncodeFrame(const Packet& packet);
+
+class Connection : public std::enable_shared_from_this<Connection> {
 public:
     Connection(SOCKET socket, const std::string& address);
     ~Connection();
 
     bool Send(const Packet& packet);
+    bool SendFrame(const SharedFrame& frame);
     bool Receive(Packet& packet);
     bool IsConnected() const { return connected_; }
     void Disconnect();
@@ -58,14 +83,45 @@ public:
     const std::string& GetAddress() const { return address_; }
     uint32_t GetId() const { return id_; }
 
+    // 리액터 모드 전용 - 논블로킹 소켓에서 사용
+    bool SetNonBlocking();
+    bool IsNonBlocking() const { return non_blocking_; }
+    // 가능한 만큼 읽고 완성된 패킷 추출. peer_closing이면(RDHUP/HUP) 짧은 읽기 생략 없이 EOF까지 읽는다
+    bool ReadPackets(std::vector<Packet>& packets, bool peer_closing = false);
+    bool FlushPendingSends();                        // 큐에 쌓인 프레임을 writev로 전송
+    void Close();                                    // 소유한 I/O 스레드에서만 호출
+
+    // 송신 큐 설정 - 큐가 비어있다가 채워지면 requester로 소유 리액터에 플러시를 요청
+    void SetSendQueueLimit(size_t max_bytes, SendOverflowPolicy policy);
+    void SetFlushRequester(std::function<void(Connection*)> requester);
+    void ClearFlushScheduled() { flush_scheduled_ = false; }
+    size_t GetQueuedBytes() const;
+    uint64_t GetDroppedPackets() const { return dropped_packets_; }
+
 private:
+    bool SendBlocking(const ByteBuffer& frame);
+
     SOCKET socket_;
     std::string address_;
     uint32_t id_;
     std::atomic<bool> connected_;
+    bool non_blocking_;
     mutable std::mutex send_mutex_;
     mutable std::mutex recv_mutex_;
 
+    // 수신 프레임 버퍼
+    std::unique_ptr<RecvBuffer> recv_buffer_;
+
+    // 송신 큐 - 인코딩된 프레임 단위, 앞 프레임은 send_queue_offset_까지 전송됨
+    std::deque<SharedFrame, PoolAllocator<SharedFrame>> send_queue_;
+    size_t send_queue_offset_;
+    size_t queued_bytes_;
+    size_t send_queue_limit_;
+    SendOverflowPolicy overflow_policy_;
+    std::atomic<bool> flush_scheduled_;
+    std::atomic<uint64_t> dropped_packets_;
+    std::function<void(Connection*)> flush_requester_;
+
     static std::atomic<uint32_t> next_id_;
 };
 
@@ -74,8 +130,8 @@ public:
     NetworkManager();
     ~NetworkManager();
 
-    // 서버 초기화
-    bool InitializeServer(int port, int max_connections = 1000);
+    // 서버 초기화 (io_threads: 리액터 수, 0이면 코어 수 기반 기본값)
+    bool InitializeServer(int port, int max_connections = 1000, int io_threads = 0);
 
     // 클라이언트 초기화
     bool InitializeClient();
@@ -95,11 +151,15 @@ public:
     // 패킷 전송
     bool SendToClient(std::shared_ptr<Connection> connection, const Packet& packet);
     bool SendToAll(const Packet& packet);
+    bool SendToGroup(const std::vector<std::shared_ptr<Connection>>& connections, const Packet& packet);
 
     // 연결 관리
     std::vector<std::shared_ptr<Connection>> GetConnections() const;
     void DisconnectClient(std::shared_ptr<Connection> connection);
 
+    // 연결별 송신 큐 상한 (이후 accept되는 연결에 적용)
+    void SetSendQueueLimit(size_t max_bytes, SendOverflowPolicy policy);
+
     // 상태 확인
     bool IsServerRunning() const { return server_running_; }
     int GetConnectionCount() const;
@@ -109,6 +169,40 @@ private:
     void ClientHandlerThread(std::shared_ptr<Connection> connection);
     void CleanupConnections();
 
+#ifdef __linux__
+    // epoll 리액터 - 루프마다 SO_REUSEPORT 리슨 소켓을 가지며,
+    // 연결은 accept한 루프에 고정되어 해당 스레드만 이벤트를 처리한다
+    struct IoLoop {
+        int epoll_fd = -1;
+        int wake_fd = -1;                  // 다른 스레드의 플러시 요청 통지용 eventfd
+        SOCKET listen_socket = INVALID_SOCKET;
+        int cpu = 0;
+        std::thread thread;
+
+        std::mutex pending_mutex;
+        std::vector<std::shared_ptr<Connection>> pending_flush;
+
+        // 루프 스레드 전용 재사용 버퍼 - 이벤트마다 새로 할당하지 않도록 용량을 유지한다
+        std::vector<std::shared_ptr<Connection>> flush_batch;
+        std::vector<Packet> packet_batch;
+    };
+
+    void AcceptConnections(IoLoop* loop);
+    void IoLoopThread(IoLoop* loop);
+    void HandleConnectionEvent(IoLoop* loop, Connection* connection, uint32_t events);
+    void CloseConnection(IoLoop* loop, std::shared_ptr<Connection> connection);
+    void RequestFlush(IoLoop* loop, Connection* connection);
+    void FlushPendingConnections(IoLoop* loop);
+    void StopIoLoops();
+    void CloseIoLoops();
+#endif
+
+    // 연결 목록은 copy-on-write - 변경 시 새 목록을 만들고, 읽는 쪽은 스냅샷만 잡는다
+    using ConnectionList = std::vector<std::shared_ptr<Connection>>;
+    void AddConnection(const std::shared_ptr<Connection>& connection);
+    void RemoveConnection(const std::shared_ptr<Connection>& connection);
+    std::shared_ptr<const ConnectionList> GetConnectionSnapshot() const;
+
     SOCKET server_socket_;
     std::atomic<bool> server_running_;
     std::atomic<bool> shutdown_requested_;
@@ -116,7 +210,7 @@ private:
     std::thread server_thread_;
     std::vector<std::thread> client_threads_;
 
-    std::vector<std::shared_ptr<Connection>> connections_;
+    std::shared_ptr<const ConnectionList> connections_;
     mutable std::mutex connections_mutex_;
 
     // 콜백 함수들
@@ -126,11 +220,13 @@ private:
 
     int max_connections_;
     int server_port_;
+    size_t send_queue_limit_;
+    SendOverflowPolicy send_overflow_policy_;
 
 #ifdef _WIN32
     bool wsa_initialized_;
 #elif __linux__
-    int epoll_fd_;
+    std::vector<std::unique_ptr<IoLoop>> io_loops_;
 #elif __APPLE__
     int kqueue_fd_;
 #endif
@@ -146,14 +242,18 @@ enum PacketType : uint16_t {
     PACKET_GAME_DATA = 200,
     PACKET_PLAYER_MOVE = 201,
     PACKET_PLAYER_CHAT = 202,
+    PACKET_SNAPSHOT = 203,
+    PACKET_SNAPSHOT_ACK = 204,
+    PACKET_PLAYER_MOVE_INPUT = 205,
     PACKET_ZONE_CHANGE = 300,
     PACKET_ZONE_DATA = 301
 };
 
-// 유틸리티 함수들
-std::vector<uint8_t> SerializeString(const std::string& str);
-std::string DeserializeString(const std::vector<uint8_t>& data, size_t& offset);
-void SerializeInt32(std::vector<uint8_t>& data, int32_t value);
-int32_t DeserializeInt32(const std::vector<uint8_t>& data, size_t& offset);
+// 유틸리티 함수들 - PacketWriter/PacketReader의 얇은 래퍼
+ByteBuffer SerializeString(const std::string& str);
+std::string DeserializeString(const ByteBuffer& data, size_t& offset);
+void SerializeInt32(ByteBuffer& data, int32_t value);
+int32_t DeserializeInt32(const ByteBuffer& data, size_t& offset);
+SendOverflowPolicy ParseSendOverflowPolicy(const std::string& policy); // "drop" 외에는 DISCONNECT
 
 } // namespace Network
\ No newline at end of file
@@ -0,0 +1,170 @@
+// network/packet_dispatcher.cpp
+#include "packet_dispatcher.h"
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+namespace Network {
+
+struct PacketDispatcher::Entry {
+    std::function<bool(const ConnectionPtr&, const Packet&)> handler;
+
+    std::atomic<uint64_t> handled{0};
+    std::atomic<uint64_t> malformed{0};
+    std::atomic<uint64_t> total_ns{0};
+    std::atomic<uint64_t> max_ns{0};
+    std::array<std::atomic<uint64_t>, kLatencyBuckets> histogram{};
+};
+
+namespace {
+
+size_t LatencyBucket(uint64_t nanoseconds) {
+    uint64_t micros = nanoseconds / 1000;
+    size_t bucket = 0;
+    while (micros > 0 && bucket < PacketDispatcher::kLatencyBuckets - 1) {
+        micros >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+} // anonymous namespace
+
+PacketDispatcher::PacketDispatcher()
+    : table_(kMaxPacketTypes)
+    , unknown_packets_(0)
+    , last_unknown_type_(0) {
+}
+
+PacketDispatcher::~PacketDispatcher() = default;
+
+void PacketDispatcher::Install(uint16_t type, std::function<bool(const ConnectionPtr&, const Packet&)> handler) {
+    if (type >= kMaxPacketTypes) {
+        std::cerr << "PacketDispatcher: packet type " << type << " exceeds table size" << std::endl;
+        return;
+    }
+    if (!table_[type]) {
+        table_[type] = std::make_unique<Entry>();
+    }
+    table_[type]->handler = std::move(handler);
+}
+
+void PacketDispatcher::RegisterRaw(uint16_t type, RawHandler handler) {
+    Install(type, [handler = std::move(handler)](const ConnectionPtr& connection, const Packet& packet) {
+        handler(connection, packet);
+        return true;
+    });
+}
+
+PacketDispatcher::Result PacketDispatcher::Dispatch(const ConnectionPtr& connection, const Packet& packet) {
+    // 미등록 타입은 로그 없이 카운트만 하고 버린다 (조회는 status에서)
+    if (packet.type >= table_.size() || !table_[packet.type]) {
+        unknown_packets_.fetch_add(1, std::memory_order_relaxed);
+        last_unknown_type_.store(packet.type, std::memory_order_relaxed);
+        return Result::UNKNOWN_TYPE;
+    }
+
+    Entry& entry = *table_[packet.type];
+    auto start = std::chrono::steady_clock::now();
+    bool decoded = entry.handler(connection, packet);
+    uint64_t elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+
+    if (!decoded) {
+        entry.malformed.fetch_add(1, std::memory_order_relaxed);
+        return Result::MALFORMED;
+    }
+
+    entry.handled.fetch_add(1, std::memory_order_relaxed);
+    entry.total_ns.fetch_add(elapsed, std::memory_order_relaxed);
+    entry.histogram[LatencyBucket(elapsed)].fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t current_max = entry.max_ns.load(std::memory_order_relaxed);
+    while (elapsed > current_max &&
+           !entry.max_ns.compare_exchange_weak(current_max, elapsed, std::memory_order_relaxed)) {}
+
+    return Result::HANDLED;
+}
+
+std::vector<PacketDispatcher::HandlerStats> PacketDispatcher::GetStats() const {
+    std::vector<HandlerStats> stats;
+    for (size_t type = 0; type < table_.size(); ++type) {
+        const Entry* entry = table_[type].get();
+        if (!entry) {
+            continue;
+        }
+
+        HandlerStats item;
+        item.type = static_cast<uint16_t>(type);
+        item.name = PacketTypeName(item.type);
+        item.handled = entry->handled.load(std::memory_order_relaxed);
+        item.malformed = entry->malformed.load(std::memory_order_relaxed);
+        item.total_ns = entry->total_ns.load(std::memory_order_relaxed);
+        item.max_ns = entry->max_ns.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < kLatencyBuckets; ++i) {
+            item.histogram[i] = entry->histogram[i].load(std::memory_order_relaxed);
+        }
+        stats.push_back(item);
+    }
+    return stats;
+}
+
+uint64_t PacketDispatcher::HandlerStats::PercentileMicros(double percentile) const {
+    uint64_t total = 0;
+    for (uint64_t count : histogram) {
+        total += count;
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    uint64_t target = static_cast<uint64_t>(total * percentile / 100.0);
+    if (target == 0) {
+        target = 1;
+    }
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kLatencyBuckets; ++i) {
+        seen += histogram[i];
+        if (seen >= target) {
+            // 마지막 버킷은 상한이 없으므로 최댓값으로 대신한다
+            return i + 1 < kLatencyBuckets ? (uint64_t(1) << i) : max_ns / 1000;
+        }
+    }
+    return max_ns / 1000;
+}
+
+std::string PacketDispatcher::HandlerStats::Describe() const {
+    char line[192];
+    std::snprintf(line, sizeof(line),
+                  "%-14s (%3u) handled=%llu malformed=%llu avg=%.1fus p50<=%lluus p99<=%lluus max=%.1fus",
+                  name, type,
+                  static_cast<unsigned long long>(handled),
+                  static_cast<unsigned long long>(malformed),
+                  handled > 0 ? total_ns / 1000.0 / handled : 0.0,
+                  static_cast<unsigned long long>(PercentileMicros(50)),
+                  static_cast<unsigned long long>(PercentileMicros(99)),
+                  max_ns / 1000.0);
+    return line;
+}
+
+const char* PacketTypeName(uint16_t type) {
+    switch (type) {
+        case PACKET_ECHO: return "ECHO";
+        case PACKET_AUTH_REQUEST: return "AUTH_REQUEST";
+        case PACKET_AUTH_RESPONSE: return "AUTH_RESPONSE";
+        case PACKET_LOGIN_REQUEST: return "LOGIN_REQUEST";
+        case PACKET_LOGIN_RESPONSE: return "LOGIN_RESPONSE";
+        case PACKET_GAME_DATA: return "GAME_DATA";
+        case PACKET_PLAYER_MOVE: return "PLAYER_MOVE";
+        case PACKET_PLAYER_CHAT: return "PLAYER_CHAT";
+        case PACKET_SNAPSHOT: return "SNAPSHOT";
+        case PACKET_SNAPSHOT_ACK: return "SNAPSHOT_ACK";
+        case PACKET_PLAYER_MOVE_INPUT: return "PLAYER_MOVE_INPUT";
+        case PACKET_ZONE_CHANGE: return "ZONE_CHANGE";
+        case PACKET_ZONE_DATA: return "ZONE_DATA";
+        default: return "UNKNOWN";
+    }
+}
+
+} // namespace Network
@@ -0,0 +1,85 @@
+// network/packet_dispatcher.h
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "network_manager.h"
+#include "packet_schema.h"
+
+namespace Network {
+
+// 패킷 타입을 인덱스로 하는 평면 테이블 기반 디스패처
+// 핸들러는 스키마로 미리 디코딩된 타입 페이로드를 받으며, 타입별 처리 횟수/디코딩 실패/
+// 처리 시간 히스토그램을 원자 카운터로 집계한다. 등록되지 않은 타입은 카운트만 하고 버린다.
+// 핸들러 등록은 서버 시작 전에 끝내야 한다 (Dispatch는 여러 I/O 스레드에서 동시에 호출된다).
+class PacketDispatcher {
+public:
+    using ConnectionPtr = std::shared_ptr<Connection>;
+    using RawHandler = std::function<void(const ConnectionPtr&, const Packet&)>;
+
+    static constexpr size_t kMaxPacketTypes = 1024;
+    static constexpr size_t kLatencyBuckets = 18;   // 1us 미만, 2^n us 미만 (n = 1..16), 그 이상
+
+    enum class Result {
+        HANDLED,
+        UNKNOWN_TYPE,
+        MALFORMED
+    };
+
+    struct HandlerStats {
+        uint16_t type;
+        const char* name;
+        uint64_t handled;
+        uint64_t malformed;
+        uint64_t total_ns;
+        uint64_t max_ns;
+        std::array<uint64_t, kLatencyBuckets> histogram;
+
+        // 히스토그램 버킷 상한 기준 백분위 (마이크로초)
+        uint64_t PercentileMicros(double percentile) const;
+        std::string Describe() const;
+    };
+
+    PacketDispatcher();
+    ~PacketDispatcher();
+
+    // 스키마 T로 디코딩한 뒤 handler(connection, const T&) 호출
+    template<typename T, typename Handler>
+    void Register(Handler handler) {
+        Install(T::kType, [handler = std::move(handler)](const ConnectionPtr& connection, const Packet& packet) {
+            T message;
+            if (!DecodePacket(packet, message)) {
+                return false;
+            }
+            handler(connection, message);
+            return true;
+        });
+    }
+
+    // 디코딩 없이 원시 패킷을 받는 핸들러
+    void RegisterRaw(uint16_t type, RawHandler handler);
+
+    Result Dispatch(const ConnectionPtr& connection, const Packet& packet);
+
+    std::vector<HandlerStats> GetStats() const;
+    uint64_t GetUnknownCount() const { return unknown_packets_.load(std::memory_order_relaxed); }
+    uint16_t GetLastUnknownType() const { return last_unknown_type_.load(std::memory_order_relaxed); }
+
+private:
+    struct Entry;
+
+    void Install(uint16_t type, std::function<bool(const ConnectionPtr&, const Packet&)> handler);
+
+    std::vector<std::unique_ptr<Entry>> table_;
+    std::atomic<uint64_t> unknown_packets_;
+    std::atomic<uint16_t> last_unknown_type_;
+};
+
+const char* PacketTypeName(uint16_t type);
+
+} // namespace Network
@@ -0,0 +1,368 @@
+// network/packet_schema.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "network_manager.h"
+
+namespace Network {
+
+// =============================================================================
+// 패킷 스키마
+// 패킷마다 구조체 하나로 정의하고 Fields()에 와이어 순서대로 멤버를 나열한다.
+// 인코더/디코더는 PacketCodec 템플릿이 스키마로부터 생성하며,
+// 모든 필드가 고정 크기면 와이어 크기와 필드 오프셋이 컴파일 타임 상수가 된다.
+//
+// 지원 필드 타입: 정수(int8~uint64), float, double, std::string_view(uint16 길이 접두사)
+// 디코딩된 string_view는 원본 Packet::data를 가리키므로 패킷이 살아있는 동안만 유효하다.
+// =============================================================================
+
+// 에코 (요청/응답 공통)
+struct EchoMessage {
+    static constexpr PacketType kType = PACKET_ECHO;
+    std::string_view message;
+
+    static constexpr auto Fields() { return std::make_tuple(&EchoMessage::message); }
+};
+
+struct AuthRequest {
+    static constexpr PacketType kType = PACKET_AUTH_REQUEST;
+    std::string_view username;
+    std::string_view password;
+
+    static constexpr auto Fields() {
+        return std::make_tuple(&AuthRequest::username, &AuthRequest::password);
+    }
+};
+
+struct AuthResponse {
+    static constexpr PacketType kType = PACKET_AUTH_RESPONSE;
+    std::string_view message;
+
+    static constexpr auto Fields() { return std::make_tuple(&AuthResponse::message); }
+};
+
+struct LoginRequest {
+    static constexpr PacketType kType = PACKET_LOGIN_REQUEST;
+    std::string_view username;
+
+    static constexpr auto Fields() { return std::make_tuple(&LoginRequest::username); }
+};
+
+struct LoginResponse {
+    static constexpr PacketType kType = PACKET_LOGIN_RESPONSE;
+    std::string_view message;
+
+    static constexpr auto Fields() { return std::make_tuple(&LoginResponse::message); }
+};
+
+struct GameDataMessage {
+    static constexpr PacketType kType = PACKET_GAME_DATA;
+    std::string_view message;
+
+    static constexpr auto Fields() { return std::make_tuple(&GameDataMessage::message); }
+};
+
+// 이동 요청 - 한 번 적용하는 위치 변화량, 고정 크기 (4바이트)
+struct PlayerMoveRequest {
+    static constexpr PacketType kType = PACKET_PLAYER_MOVE;
+    int16_t dx;
+    int16_t dy;
+
+    static constexpr auto Fields() {
+        return std::make_tuple(&PlayerMoveRequest::dx, &PlayerMoveRequest::dy);
+    }
+};
+
+// 이동 결과 - 고정 크기 (12바이트)
+struct PlayerMoveResult {
+    static constexpr PacketType kType = PACKET_PLAYER_MOVE;
+    uint32_t player_id;
+    int32_t x;
+    int32_t y;
+
+    static constexpr auto Fields() {
+        return std::make_tuple(&PlayerMoveResult::player_id, &PlayerMoveResult::x, &PlayerMoveResult::y);
+    }
+};
+
+// 이동 입력 - 다음 입력까지 유지되는 이동 방향 ((0, 0)이면 정지), 고정 크기 (4바이트)
+// 속도는 서버가 정한다 - 방향 벡터의 크기는 무시된다.
+struct PlayerMoveInput {
+    static constexpr PacketType kType = PACKET_PLAYER_MOVE_INPUT;
+    int16_t dir_x;
+    int16_t dir_y;
+
+    static constexpr auto Fields() {
+        return std::make_tuple(&PlayerMoveInput::dir_x, &PlayerMoveInput::dir_y);
+    }
+};
+
+// 채팅 (요청/브로드캐스트 공통)
+struct ChatMessage {
+    static constexpr PacketType kType = PACKET_PLAYER_CHAT;
+    std::string_view message;
+
+    static constexpr auto Fields() { return std::make_tuple(&ChatMessage::message); }
+};
+
+// 월드 스냅샷 - entities는 baseline_sequence 대비 변경분 (snapshot_replicator.h 참고)
+// baseline_sequence가 0이면 전체 상태
+struct SnapshotMessage {
+    static constexpr PacketType kType = PACKET_SNAPSHOT;
+    uint32_t sequence;
+    uint32_t baseline_sequence;
+    std::string_view entities;
+
+    static constexpr auto Fields() {
+        return std::make_tuple(&SnapshotMessage::sequence, &SnapshotMessage::baseline_sequence,
+                               &SnapshotMessage::entities);
+    }
+};
+
+// 클라이언트가 적용을 마친 스냅샷 번호 - 이후 델타의 기준이 된다
+struct SnapshotAck {
+    static constexpr PacketType kType = PACKET_SNAPSHOT_ACK;
+    uint32_t sequence;
+
+    static constexpr auto Fields() { return std::make_tuple(&SnapshotAck::sequence); }
+};
+
+struct ZoneChangeRequest {
+    static constexpr PacketType kType = PACKET_ZONE_CHANGE;
+    uint32_t target_zone_id;
+
+    static constexpr auto Fields() { return std::make_tuple(&ZoneChangeRequest::target_zone_id); }
+};
+
+struct ZoneChangeResponse {
+    static constexpr PacketType kType = PACKET_ZONE_CHANGE;
+    std::string_view message;
+
+    static constexpr auto Fields() { return std::make_tuple(&ZoneChangeResponse::message); }
+};
+
+// 존 데이터 요청 - 본문 없음
+struct ZoneDataRequest {
+    static constexpr PacketType kType = PACKET_ZONE_DATA;
+
+    static constexpr auto Fields() { return std::make_tuple(); }
+};
+
+struct ZoneDataResponse {
+    static constexpr PacketType kType = PACKET_ZONE_DATA;
+    int32_t zone_id;
+    int32_t width;
+    int32_t height;
+
+    static constexpr auto Fields() {
+        return std::make_tuple(&ZoneDataResponse::zone_id, &ZoneDataResponse::width, &ZoneDataResponse::height);
+    }
+};
+
+// 모든 스키마 목록 - PacketType을 추가하면 여기에도 스키마를 등록해야 한다
+using PacketSchemas = std::tuple<
+    EchoMessage, AuthRequest, AuthResponse, LoginRequest, LoginResponse, GameDataMessage,
+    PlayerMoveRequest, PlayerMoveResult, PlayerMoveInput, ChatMessage, SnapshotMessage, SnapshotAck,
+    ZoneChangeRequest, ZoneChangeResponse, ZoneDataRequest, ZoneDataResponse>;
+
+// =============================================================================
+// 코덱 구현
+// =============================================================================
+namespace Detail {
+
+template<typename M>
+struct MemberPointerTraits;
+
+template<typename C, typename V>
+struct MemberPointerTraits<V C::*> {
+    using Value = V;
+};
+
+template<typename T, typename = void>
+struct FieldCodec;
+
+// 산술 타입 - 리틀 엔디언 고정 크기
+template<typename T>
+struct FieldCodec<T, std::enable_if_t<std::is_arithmetic<T>::value>> {
+    static constexpr bool kFixed = true;
+    static constexpr size_t kSize = sizeof(T);
+
+    using Bits = std::conditional_t<sizeof(T) == 1, uint8_t,
+                 std::conditional_t<sizeof(T) == 2, uint16_t,
+                 std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+    static size_t EncodedSize(T) { return kSize; }
+
+    static void Store(uint8_t* out, T value) {
+        Bits bits;
+        std::memcpy(&bits, &value, kSize);
+        bits = ToLittleEndian(bits);
+        std::memcpy(out, &bits, kSize);
+    }
+
+    static void Load(const uint8_t* in, T& value) {
+        Bits bits;
+        std::memcpy(&bits, in, kSize);
+        bits = ToLittleEndian(bits);
+        std::memcpy(&value, &bits, kSize);
+    }
+
+    static void Write(PacketWriter& writer, T value) {
+        uint8_t bytes[kSize];
+        Store(bytes, value);
+        writer.WriteBytes(bytes, kSize);
+    }
+
+    static bool Read(PacketReader& reader, T& value) {
+        const uint8_t* bytes;
+        if (!reader.ReadBytes(kSize, bytes)) return false;
+        Load(bytes, value);
+        return true;
+    }
+};
+
+// 문자열 - uint16 길이 접두사 + 바이트
+template<>
+struct FieldCodec<std::string_view> {
+    static constexpr bool kFixed = false;
+    static constexpr size_t kSize = sizeof(uint16_t);   // 최소 크기
+
+    static size_t EncodedSize(std::string_view value) {
+        return kSize + (value.size() > UINT16_MAX ? UINT16_MAX : value.size());
+    }
+
+    static void Write(PacketWriter& writer, std::string_view value) { writer.WriteString(value); }
+    static bool Read(PacketReader& reader, std::string_view& value) { return reader.ReadString(value); }
+};
+
+template<typename Member>
+using FieldCodecOf = FieldCodec<typename MemberPointerTraits<Member>::Value>;
+
+template<typename Tuple>
+struct FieldList;
+
+template<typename... Members>
+struct FieldList<std::tuple<Members...>> {
+    static constexpr bool kAllFixed = (FieldCodecOf<Members>::kFixed && ... && true);
+    static constexpr size_t kMinSize = (FieldCodecOf<Members>::kSize + ... + 0);
+};
+
+template<typename Schema, typename Tuple>
+struct SchemaListContains;
+
+template<typename Schema, typename... Schemas>
+struct SchemaListContains<Schema, std::tuple<Schemas...>>
+    : std::bool_constant<(std::is_same<Schema, Schemas>::value || ...)> {};
+
+template<typename Tuple>
+struct SchemaTypeCoverage;
+
+template<typename... Schemas>
+struct SchemaTypeCoverage<std::tuple<Schemas...>> {
+    static constexpr bool Covers(PacketType type) {
+        return ((Schemas::kType == type) || ...);
+    }
+};
+
+} // namespace Detail
+
+template<typename T>
+class PacketCodec {
+    using Fields = Detail::FieldList<decltype(T::Fields())>;
+
+public:
+    // 모든 필드가 고정 크기인지, 그렇다면 와이어 크기 (가변 패킷이면 최소 크기)
+    static constexpr bool kFixedSize = Fields::kAllFixed;
+    static constexpr size_t kWireSize = Fields::kMinSize;
+
+    static Packet Encode(const T& message) {
+        if constexpr (kFixedSize) {
+            // 크기가 정해져 있으므로 버퍼를 한 번에 잡고 상수 오프셋에 기록
+            ByteBuffer data(kWireSize);
+            std::apply([&](auto... members) {
+                uint8_t* out = data.data();
+                ((Detail::FieldCodecOf<decltype(members)>::Store(out, message.*members),
+                  out += Detail::FieldCodecOf<decltype(members)>::kSize), ...);
+                (void)out;
+            }, T::Fields());
+            return Packet(T::kType, std::move(data));
+        } else {
+            size_t size = std::apply([&](auto... members) {
+                return (Detail::FieldCodecOf<decltype(members)>::EncodedSize(message.*members) + ... + 0);
+            }, T::Fields());
+
+            PacketWriter writer(size);
+            std::apply([&](auto... members) {
+                (Detail::FieldCodecOf<decltype(members)>::Write(writer, message.*members), ...);
+            }, T::Fields());
+            return Packet(T::kType, writer.Release());
+        }
+    }
+
+    // 타입이 다르거나 본문이 스키마와 맞지 않으면 false
+    static bool Decode(const Packet& packet, T& message) {
+        if (packet.type != T::kType) {
+            return false;
+        }
+
+        if constexpr (kFixedSize) {
+            if (packet.data.size() != kWireSize) {
+                return false;
+            }
+            std::apply([&](auto... members) {
+                const uint8_t* in = packet.data.data();
+                ((Detail::FieldCodecOf<decltype(members)>::Load(in, message.*members),
+                  in += Detail::FieldCodecOf<decltype(members)>::kSize), ...);
+                (void)in;
+            }, T::Fields());
+            return true;
+        } else {
+            PacketReader reader(packet.data);
+            return std::apply([&](auto... members) {
+                return (Detail::FieldCodecOf<decltype(members)>::Read(reader, message.*members) && ... && true);
+            }, T::Fields());
+        }
+    }
+};
+
+template<typename T>
+Packet EncodePacket(const T& message) {
+    static_assert(Detail::SchemaListContains<T, PacketSchemas>::value, "T must be listed in PacketSchemas");
+    return PacketCodec<T>::Encode(message);
+}
+
+template<typename T>
+bool DecodePacket(const Packet& packet, T& message) {
+    static_assert(Detail::SchemaListContains<T, PacketSchemas>::value, "T must be listed in PacketSchemas");
+    return PacketCodec<T>::Decode(packet, message);
+}
+
+// 스키마 검증 - 모든 PacketType에 스키마가 있어야 한다
+static_assert(Detail::SchemaTypeCoverage<PacketSchemas>::Covers(PACKET_ECHO), "PACKET_ECHO has no schema");
+static_assert(Detail::SchemaTypeCoverage<PacketSchemas>::Covers(PACKET_AUTH_REQUEST), "PACKET_AUTH_REQUEST has no schema");
+static_assert(Detail::SchemaTypeCoverage<PacketSchemas>::Covers(PACKET_AUTH_RESPONSE), "PACKET_AUTH_RESPONSE has no schema");
+static_assert(Detail::SchemaTypeCoverage<PacketSchemas>::Covers(PACKET_LOGIN_REQUEST), "PACKET_LOGIN_REQUEST has no schema");
+static_assert(Detail::SchemaTypeCoverage<PacketSchemas>::Covers(PACKET_LOGIN_RESPONSE), "PACKET_LOGIN_RESPONSE has no schema");
+static_assert(Detail::SchemaTypeCoverage<PacketSchemas>::Covers(PACKET_GAME_DATA), "PACKET_GAME_DATA has no schema");
+static_assert(Detail::SchemaTypeCoverage<PacketSchemas>::Covers(PACKET_PLAYER_MOVE), "PACKET_PLAYER_MOVE has no schema");
+static_assert(Detail::SchemaTypeCoverage<PacketSchemas>::Covers(PACKET_PLAYER_CHAT), "PACKET_PLAYER_CHAT has no schema");
+static_assert(Detail::SchemaTypeCoverage<PacketSchemas>::Covers(PACKET_SNAPSHOT), "PACKET_SNAPSHOT has no schema");
+static_assert(Detail::SchemaTypeCoverage<PacketSchemas>::Covers(PACKET_SNAPSHOT_ACK), "PACKET_SNAPSHOT_ACK has no schema");
+static_assert(Detail::SchemaTypeCoverage<PacketSchemas>::Covers(PACKET_PLAYER_MOVE_INPUT), "PACKET_PLAYER_MOVE_INPUT has no schema");
+static_assert(Detail::SchemaTypeCoverage<PacketSchemas>::Covers(PACKET_ZONE_CHANGE), "PACKET_ZONE_CHANGE has no schema");
+static_assert(Detail::SchemaTypeCoverage<PacketSchemas>::Covers(PACKET_ZONE_DATA), "PACKET_ZONE_DATA has no schema");
+
+static_assert(PacketCodec<PlayerMoveRequest>::kFixedSize && PacketCodec<PlayerMoveRequest>::kWireSize == 4,
+              "move request must stay a fixed 4-byte payload");
+static_assert(PacketCodec<PlayerMoveResult>::kFixedSize && PacketCodec<PlayerMoveResult>::kWireSize == 12,
+              "move result must stay a fixed 12-byte payload");
+static_assert(PacketCodec<PlayerMoveInput>::kFixedSize && PacketCodec<PlayerMoveInput>::kWireSize == 4,
+              "move input must stay a fixed 4-byte payload");
+
+} // namespace Network
@@ -0,0 +1,206 @@
+// network/packet_stream.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#include "buffer_pool.h"
+
+namespace Network {
+
+// 페이로드의 정수/실수는 리틀 엔디언으로 인코딩한다 (기존 SerializeInt32와 동일)
+namespace Detail {
+
+template<typename T>
+inline T ToLittleEndian(T value) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    if constexpr (sizeof(T) == 2) {
+        return static_cast<T>(__builtin_bswap16(static_cast<uint16_t>(value)));
+    } else if constexpr (sizeof(T) == 4) {
+        return static_cast<T>(__builtin_bswap32(static_cast<uint32_t>(value)));
+    } else if constexpr (sizeof(T) == 8) {
+        return static_cast<T>(__builtin_bswap64(static_cast<uint64_t>(value)));
+    }
+#endif
+    return value;
+}
+
+} // namespace Detail
+
+// 풀 버퍼에 직접 이어 쓰는 직렬화기
+// 값마다 memcpy 한 번으로 기록하고, 완성된 버퍼는 Release()로 Packet에 넘긴다.
+class PacketWriter {
+public:
+    explicit PacketWriter(size_t reserve_bytes = 64) {
+        buffer_.reserve(reserve_bytes);
+    }
+
+    void WriteInt8(int8_t value) { WriteRaw(value); }
+    void WriteUInt8(uint8_t value) { WriteRaw(value); }
+    void WriteInt16(int16_t value) { WriteRaw(value); }
+    void WriteUInt16(uint16_t value) { WriteRaw(value); }
+    void WriteInt32(int32_t value) { WriteRaw(value); }
+    void WriteUInt32(uint32_t value) { WriteRaw(value); }
+    void WriteInt64(int64_t value) { WriteRaw(value); }
+    void WriteUInt64(uint64_t value) { WriteRaw(value); }
+
+    void WriteFloat(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        WriteRaw(bits);
+    }
+
+    void WriteDouble(double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        WriteRaw(bits);
+    }
+
+    // LEB128 가변 길이 정수 (부호 있는 값은 zigzag 변환)
+    void WriteVarUInt(uint64_t value) {
+        uint8_t bytes[10];
+        size_t count = 0;
+        while (value >= 0x80) {
+            bytes[count++] = static_cast<uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        bytes[count++] = static_cast<uint8_t>(value);
+        WriteBytes(bytes, count);
+    }
+
+    void WriteVarInt(int64_t value) {
+        WriteVarUInt((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    // uint16 길이 접두사 + 바이트 (65535바이트를 넘는 부분은 잘린다)
+    void WriteString(std::string_view str) {
+        size_t length = str.size() > UINT16_MAX ? UINT16_MAX : str.size();
+        WriteUInt16(static_cast<uint16_t>(length));
+        WriteBytes(str.data(), length);
+    }
+
+    void WriteBytes(const void* data, size_t length) {
+        if (length == 0) {
+            return;
+        }
+        size_t position = buffer_.size();
+        buffer_.resize(position + length);
+        std::memcpy(buffer_.data() + position, data, length);
+    }
+
+    size_t Size() const { return buffer_.size(); }
+    const ByteBuffer& Buffer() const { return buffer_; }
+
+    // 작성한 버퍼를 넘겨준다. 이후 writer는 빈 상태가 된다.
+    ByteBuffer Release() { return std::move(buffer_); }
+
+private:
+    template<typename T>
+    void WriteRaw(T value) {
+        static_assert(std::is_integral<T>::value, "integral types only");
+        T encoded = Detail::ToLittleEndian(value);
+        WriteBytes(&encoded, sizeof(encoded));
+    }
+
+    ByteBuffer buffer_;
+};
+
+// 수신 바이트 위를 걷는 역직렬화기
+// 데이터를 복사하지 않으며 문자열/바이트는 원본을 가리키는 뷰로 반환한다.
+// 뷰는 원본 버퍼(보통 Packet::data)가 살아있는 동안만 유효하다.
+// 읽기에 실패하면 false를 반환하고 이후 모든 읽기도 실패한다.
+class PacketReader {
+public:
+    PacketReader(const uint8_t* data, size_t size)
+        : data_(data), size_(size), offset_(0), failed_(false) {}
+    explicit PacketReader(const ByteBuffer& buffer)
+        : PacketReader(buffer.data(), buffer.size()) {}
+
+    bool ReadInt8(int8_t& value) { return ReadRaw(value); }
+    bool ReadUInt8(uint8_t& value) { return ReadRaw(value); }
+    bool ReadInt16(int16_t& value) { return ReadRaw(value); }
+    bool ReadUInt16(uint16_t& value) { return ReadRaw(value); }
+    bool ReadInt32(int32_t& value) { return ReadRaw(value); }
+    bool ReadUInt32(uint32_t& value) { return ReadRaw(value); }
+    bool ReadInt64(int64_t& value) { return ReadRaw(value); }
+    bool ReadUInt64(uint64_t& value) { return ReadRaw(value); }
+
+    bool ReadFloat(float& value) {
+        uint32_t bits;
+        if (!ReadRaw(bits)) return false;
+        std::memcpy(&value, &bits, sizeof(value));
+        return true;
+    }
+
+    bool ReadDouble(double& value) {
+        uint64_t bits;
+        if (!ReadRaw(bits)) return false;
+        std::memcpy(&value, &bits, sizeof(value));
+        return true;
+    }
+
+    bool ReadVarUInt(uint64_t& value) {
+        uint64_t result = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t byte;
+            if (!ReadRaw(byte)) return false;
+            result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                value = result;
+                return true;
+            }
+        }
+        return Fail();
+    }
+
+    bool ReadVarInt(int64_t& value) {
+        uint64_t encoded;
+        if (!ReadVarUInt(encoded)) return false;
+        value = static_cast<int64_t>((encoded >> 1) ^ (~(encoded & 1) + 1));
+        return true;
+    }
+
+    bool ReadString(std::string_view& str) {
+        uint16_t length;
+        const uint8_t* bytes;
+        if (!ReadUInt16(length) || !ReadBytes(length, bytes)) return false;
+        str = std::string_view(reinterpret_cast<const char*>(bytes), length);
+        return true;
+    }
+
+    bool ReadBytes(size_t length, const uint8_t*& bytes) {
+        if (failed_ || length > size_ - offset_) return Fail();
+        bytes = data_ + offset_;
+        offset_ += length;
+        return true;
+    }
+
+    size_t Offset() const { return offset_; }
+    size_t Remaining() const { return size_ - offset_; }
+    bool Ok() const { return !failed_; }
+
+private:
+    template<typename T>
+    bool ReadRaw(T& value) {
+        static_assert(std::is_integral<T>::value, "integral types only");
+        if (failed_ || sizeof(T) > size_ - offset_) return Fail();
+        std::memcpy(&value, data_ + offset_, sizeof(T));
+        value = Detail::ToLittleEndian(value);
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    bool Fail() {
+        failed_ = true;
+        return false;
+    }
+
+    const uint8_t* data_;
+    size_t size_;
+    size_t offset_;
+    bool failed_;
+};
+
+} // namespace Network
@@ -0,0 +1,108 @@
+// network/recv_buffer.cpp
+#include "recv_buffer.h"
+#include <algorithm>
+#include <cstring>
+
+#ifndef _WIN32
+    #include <sys/uio.h>
+#endif
+
+namespace Network {
+
+RecvBuffer::RecvBuffer(size_t initial_capacity)
+    : buffer_(initial_capacity), read_index_(0), write_index_(0) {
+}
+
+long RecvBuffer::ReadFrom(SOCKET socket, bool& buffer_filled) {
+    // 남은 공간이 작으면 먼저 압축해서 한 번에 받을 수 있는 양을 늘린다
+    if (buffer_.size() - write_index_ < kHeaderSize) {
+        EnsureWritable(kHeaderSize);
+    }
+    size_t writable = buffer_.size() - write_index_;
+
+#ifdef _WIN32
+    int received = recv(socket, reinterpret_cast<char*>(buffer_.data() + write_index_),
+                        static_cast<int>(writable), 0);
+    if (received > 0) {
+        write_index_ += received;
+    }
+    buffer_filled = (received > 0 && static_cast<size_t>(received) == writable);
+    return received;
+#else
+    // 버퍼 뒤쪽 공간 + 스택 임시 공간으로 readv 한 번에 받는다
+    uint8_t extra[kExtraReadSize];
+    iovec vec[2];
+    vec[0].iov_base = buffer_.data() + write_index_;
+    vec[0].iov_len = writable;
+    vec[1].iov_base = extra;
+    vec[1].iov_len = sizeof(extra);
+
+    ssize_t received = readv(socket, vec, 2);
+    if (received <= 0) {
+        buffer_filled = false;
+        return static_cast<long>(received);
+    }
+
+    size_t count = static_cast<size_t>(received);
+    if (count <= writable) {
+        write_index_ += count;
+    } else {
+        write_index_ = buffer_.size();
+        Append(extra, count - writable);
+    }
+
+    buffer_filled = (count == writable + sizeof(extra));
+    return static_cast<long>(received);
+#endif
+}
+
+bool RecvBuffer::ExtractPacket(Packet& packet) {
+    if (ReadableBytes() < kHeaderSize) {
+        return false;
+    }
+
+    uint16_t header[2];
+    std::memcpy(header, buffer_.data() + read_index_, kHeaderSize);
+    if (ReadableBytes() < kHeaderSize + header[1]) {
+        return false;
+    }
+
+    const uint8_t* body = buffer_.data() + read_index_ + kHeaderSize;
+    packet.type = header[0];
+    packet.size = header[1];
+    packet.data.assign(body, body + header[1]);
+
+    read_index_ += kHeaderSize + header[1];
+    if (read_index_ == write_index_) {
+        // 모두 소비했으면 인덱스를 처음으로 되돌려 압축 비용을 없앤다
+        read_index_ = 0;
+        write_index_ = 0;
+    }
+    return true;
+}
+
+void RecvBuffer::Append(const uint8_t* data, size_t length) {
+    EnsureWritable(length);
+    std::memcpy(buffer_.data() + write_index_, data, length);
+    write_index_ += length;
+}
+
+void RecvBuffer::EnsureWritable(size_t length) {
+    if (buffer_.size() - write_index_ >= length) {
+        return;
+    }
+
+    size_t readable = ReadableBytes();
+    if (read_index_ + (buffer_.size() - write_index_) >= length) {
+        // 앞쪽 여유 공간을 합치면 충분하므로 읽지 않은 바이트를 앞으로 옮긴다
+        std::memmove(buffer_.data(), buffer_.data() + read_index_, readable);
+    } else {
+        std::vector<uint8_t> grown(std::max(buffer_.size() * 2, readable + length));
+        std::memcpy(grown.data(), buffer_.data() + read_index_, readable);
+        buffer_.swap(grown);
+    }
+    read_index_ = 0;
+    write_index_ = readable;
+}
+
+} // namespace Network
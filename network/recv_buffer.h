@@ -0,0 +1,42 @@
+// network/recv_buffer.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "network_manager.h"
+
+namespace Network {
+
+// 연결별 수신 버퍼
+// 한 번의 readv로 가능한 만큼 읽어 들이고, 쌓인 바이트에서 완성된 프레임을 모두 꺼낸다.
+// 읽기/쓰기 인덱스를 가진 선형 버퍼로, 앞쪽 여유 공간은 필요할 때만 압축한다.
+class RecvBuffer {
+public:
+    static constexpr size_t kHeaderSize = sizeof(uint16_t) * 2;
+    static constexpr size_t kInitialCapacity = 16 * 1024;
+    static constexpr size_t kExtraReadSize = 64 * 1024;
+
+    explicit RecvBuffer(size_t initial_capacity = kInitialCapacity);
+
+    // 소켓에서 한 번의 시스템 콜로 읽는다.
+    // 반환값: 읽은 바이트 수 (0 = 상대방 종료, -1 = 오류이며 errno 유지)
+    // buffer_filled가 true면 준비된 공간을 모두 채웠으므로 소켓에 데이터가 더 남아있을 수 있다.
+    long ReadFrom(SOCKET socket, bool& buffer_filled);
+
+    // 완성된 프레임 하나를 꺼낸다. 프레임이 부족하면 false
+    bool ExtractPacket(Packet& packet);
+
+    size_t ReadableBytes() const { return write_index_ - read_index_; }
+    size_t Capacity() const { return buffer_.size(); }
+
+private:
+    void Append(const uint8_t* data, size_t length);
+    void EnsureWritable(size_t length);
+
+    std::vector<uint8_t> buffer_;
+    size_t read_index_;
+    size_t write_index_;
+};
+
+} // namespace Network
@@ -0,0 +1,232 @@
+// network/snapshot_replicator.cpp
+#include "snapshot_replicator.h"
+#include <algorithm>
+
+namespace Network {
+
+namespace {
+
+void WriteRecord(PacketWriter& writer, uint32_t& previous_id, uint32_t id, uint8_t mask,
+                 int64_t dx, int64_t dy) {
+    writer.WriteVarUInt(id - previous_id);
+    writer.WriteUInt8(mask);
+    if (mask & SNAPSHOT_FIELD_X) {
+        writer.WriteVarInt(dx);
+    }
+    if (mask & SNAPSHOT_FIELD_Y) {
+        writer.WriteVarInt(dy);
+    }
+    previous_id = id;
+}
+
+} // anonymous namespace
+
+ByteBuffer EncodeSnapshotDelta(const WorldSnapshot* baseline, const WorldSnapshot& current) {
+    static const WorldSnapshot kEmpty;
+    const WorldSnapshot& base = baseline ? *baseline : kEmpty;
+
+    PacketWriter writer(64 + current.size() * 4);
+    uint32_t previous_id = 0;
+    size_t b = 0;
+    size_t c = 0;
+
+    // 둘 다 id 순이므로 한 번에 병합하며 차이만 기록
+    while (b < base.size() || c < current.size()) {
+        if (c == current.size() || (b < base.size() && base[b].id < current[c].id)) {
+            WriteRecord(writer, previous_id, base[b].id, SNAPSHOT_REMOVED, 0, 0);
+            ++b;
+        } else if (b == base.size() || current[c].id < base[b].id) {
+            const EntitySnapshot& entity = current[c];
+            WriteRecord(writer, previous_id, entity.id,
+                        SNAPSHOT_CREATED | SNAPSHOT_FIELD_X | SNAPSHOT_FIELD_Y, entity.x, entity.y);
+            ++c;
+        } else {
+            const EntitySnapshot& before = base[b];
+            const EntitySnapshot& after = current[c];
+            uint8_t mask = 0;
+            if (after.x != before.x) mask |= SNAPSHOT_FIELD_X;
+            if (after.y != before.y) mask |= SNAPSHOT_FIELD_Y;
+            if (mask != 0) {
+                WriteRecord(writer, previous_id, after.id, mask,
+                            int64_t(after.x) - before.x, int64_t(after.y) - before.y);
+            }
+            ++b;
+            ++c;
+        }
+    }
+    return writer.Release();
+}
+
+bool ApplySnapshotDelta(const WorldSnapshot* baseline, std::string_view delta, WorldSnapshot& result) {
+    static const WorldSnapshot kEmpty;
+    const WorldSnapshot& base = baseline ? *baseline : kEmpty;
+
+    result.clear();
+    result.reserve(base.size());
+
+    PacketReader reader(reinterpret_cast<const uint8_t*>(delta.data()), delta.size());
+    uint32_t id = 0;
+    size_t b = 0;
+
+    while (reader.Remaining() > 0) {
+        uint64_t id_delta;
+        uint8_t mask;
+        if (!reader.ReadVarUInt(id_delta) || !reader.ReadUInt8(mask)) {
+            return false;
+        }
+        id += static_cast<uint32_t>(id_delta);
+
+        // 레코드 앞쪽의 바뀌지 않은 엔티티는 그대로 복사
+        while (b < base.size() && base[b].id < id) {
+            result.push_back(base[b++]);
+        }
+
+        EntitySnapshot entity{id, 0, 0};
+        bool in_base = b < base.size() && base[b].id == id;
+        if (in_base) {
+            entity = base[b++];
+        } else if (!(mask & SNAPSHOT_CREATED)) {
+            return false;   // 기준에 없는 엔티티의 변경/삭제
+        }
+        if (mask & SNAPSHOT_REMOVED) {
+            continue;
+        }
+
+        int64_t value;
+        if (mask & SNAPSHOT_FIELD_X) {
+            if (!reader.ReadVarInt(value)) return false;
+            entity.x = static_cast<int32_t>(entity.x + value);
+        }
+        if (mask & SNAPSHOT_FIELD_Y) {
+            if (!reader.ReadVarInt(value)) return false;
+            entity.y = static_cast<int32_t>(entity.y + value);
+        }
+        result.push_back(entity);
+    }
+
+    while (b < base.size()) {
+        result.push_back(base[b++]);
+    }
+    return true;
+}
+
+SnapshotReplicator::SnapshotReplicator()
+    : sequence_(0)
+    , stats_{} {
+}
+
+void SnapshotReplicator::AddClient(uint32_t client_id) {
+    acked_[client_id] = 0;
+}
+
+void SnapshotReplicator::RemoveClient(uint32_t client_id) {
+    acked_.erase(client_id);
+}
+
+void SnapshotReplicator::Acknowledge(uint32_t client_id, uint32_t sequence) {
+    auto it = acked_.find(client_id);
+    if (it == acked_.end() || sequence <= it->second || sequence > sequence_) {
+        return;
+    }
+    it->second = sequence;
+}
+
+uint32_t SnapshotReplicator::Capture(WorldSnapshot state) {
+    std::sort(state.begin(), state.end(), [](const EntitySnapshot& a, const EntitySnapshot& b) {
+        return a.id < b.id;
+    });
+    stats_.truncated_entities = 0;
+    if (state.size() > kMaxSnapshotEntities) {
+        stats_.truncated_entities = state.size() - kMaxSnapshotEntities;
+        ++stats_.truncated_captures;
+        state.resize(kMaxSnapshotEntities);
+    }
+
+    ++sequence_;
+    HistoryEntry& entry = history_[sequence_ % kSnapshotHistorySize];
+    entry.sequence = sequence_;
+    entry.state = std::make_shared<const WorldSnapshot>(std::move(state));
+
+    frame_cache_.clear();
+    return sequence_;
+}
+
+const WorldSnapshot* SnapshotReplicator::FindSnapshot(uint32_t sequence) const {
+    if (sequence == 0) {
+        return nullptr;
+    }
+    const HistoryEntry& entry = history_[sequence % kSnapshotHistorySize];
+    return entry.sequence == sequence ? entry.state.get() : nullptr;
+}
+
+SharedFrame SnapshotReplicator::BuildFrame(uint32_t client_id) {
+    const WorldSnapshot* current = FindSnapshot(sequence_);
+    auto it = acked_.find(client_id);
+    if (!current || it == acked_.end()) {
+        return nullptr;
+    }
+
+    // 기준이 히스토리에서 밀려났으면 전체 상태
+    const WorldSnapshot* baseline = FindSnapshot(it->second);
+    uint32_t baseline_sequence = baseline ? it->second : 0;
+
+    CachedFrame& cached = frame_cache_[baseline_sequence];
+    if (!cached.frame) {
+        ByteBuffer delta = EncodeSnapshotDelta(baseline, *current);
+        if (delta.size() > kMaxSnapshotPayload) {
+            // 오래된 기준 대비 삭제와 생성이 쌓이면 본문에 넘친다 - 항상 들어가는 전체 상태로 대신한다
+            baseline_sequence = 0;
+            delta = EncodeSnapshotDelta(nullptr, *current);
+        }
+        std::string_view entities(reinterpret_cast<const char*>(delta.data()), delta.size());
+        cached.frame = EncodeFrame(EncodePacket(SnapshotMessage{sequence_, baseline_sequence, entities}));
+        cached.full = baseline_sequence == 0;
+        ++stats_.encoded_frames;
+    }
+
+    if (cached.full) {
+        ++stats_.full_frames;
+    } else {
+        ++stats_.delta_frames;
+    }
+    stats_.bytes_sent += cached.frame->size();
+    return cached.frame;
+}
+
+SnapshotReplicator::Stats SnapshotReplicator::GetStats() const {
+    Stats stats = stats_;
+    stats.sequence = sequence_;
+    stats.clients = acked_.size();
+    return stats;
+}
+
+bool SnapshotReceiver::Apply(const Packet& packet, uint32_t& sequence) {
+    SnapshotMessage message;
+    if (!DecodePacket(packet, message) || message.sequence <= latest_sequence_) {
+        return false;
+    }
+
+    const WorldSnapshot* baseline = nullptr;
+    if (message.baseline_sequence != 0) {
+        const HistoryEntry& entry = history_[message.baseline_sequence % kSnapshotHistorySize];
+        if (entry.sequence != message.baseline_sequence) {
+            return false;   // 기준을 잃었으면 확인하지 않는다 - 서버가 전체 상태로 되돌아간다
+        }
+        baseline = &entry.state;
+    }
+
+    WorldSnapshot state;
+    if (!ApplySnapshotDelta(baseline, message.entities, state)) {
+        return false;
+    }
+
+    HistoryEntry& entry = history_[message.sequence % kSnapshotHistorySize];
+    entry.sequence = message.sequence;
+    entry.state = state;
+    latest_ = std::move(state);
+    latest_sequence_ = message.sequence;
+    sequence = message.sequence;
+    return true;
+}
+
+} // namespace Network
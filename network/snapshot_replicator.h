@@ -0,0 +1,126 @@
+// network/snapshot_replicator.h
+#pragma once
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "network_manager.h"
+#include "packet_schema.h"
+
+namespace Network {
+
+// 복제 대상 엔티티 상태 - 위치는 정수 격자 단위라 양자화 단계는 1이다
+struct EntitySnapshot {
+    uint32_t id;
+    int32_t x;
+    int32_t y;
+};
+
+// 한 틱의 월드 상태 (id 오름차순)
+using WorldSnapshot = std::vector<EntitySnapshot>;
+
+// 델타 인코딩 형식 (SnapshotMessage::entities)
+// 기준(baseline) 대비 바뀐 엔티티마다 레코드 하나, id 오름차순, 본문 끝까지 반복:
+//   varuint  id 증가분 (직전 레코드 id 대비, 첫 레코드는 0 대비)
+//   uint8    필드 마스크 (SNAPSHOT_FIELD_*)
+//   varint   x 변화량 (FIELD_X일 때, 지그재그) - 새 엔티티는 0 대비
+//   varint   y 변화량 (FIELD_Y일 때)
+// 기준에만 있는 엔티티는 REMOVED 레코드, 바뀌지 않은 엔티티는 생략된다.
+enum SnapshotFieldMask : uint8_t {
+    SNAPSHOT_FIELD_X = 1 << 0,
+    SNAPSHOT_FIELD_Y = 1 << 1,
+    SNAPSHOT_REMOVED = 1 << 2,
+    SNAPSHOT_CREATED = 1 << 3
+};
+
+// 스냅샷 하나에 담을 수 있는 엔티티 상한 - 전체 상태(CREATED 레코드만)는 레코드 최악 크기로도
+// uint16 본문에 들어간다. 오래된 기준 대비 델타는 REMOVED 레코드까지 더해져 넘칠 수 있으므로
+// BuildFrame이 크기를 확인해 넘치면 전체 상태로 보낸다.
+constexpr size_t kMaxSnapshotEntities = 4000;
+constexpr size_t kMaxSnapshotRecordSize = 16;   // varuint id(5) + 마스크(1) + varint x(5) + varint y(5)
+constexpr size_t kMaxSnapshotPayload = UINT16_MAX - PacketCodec<SnapshotMessage>::kWireSize;
+constexpr size_t kSnapshotHistorySize = 32;
+
+static_assert(kMaxSnapshotEntities * kMaxSnapshotRecordSize <= kMaxSnapshotPayload,
+              "a full snapshot must fit in one packet");
+
+ByteBuffer EncodeSnapshotDelta(const WorldSnapshot* baseline, const WorldSnapshot& current);
+bool ApplySnapshotDelta(const WorldSnapshot* baseline, std::string_view delta, WorldSnapshot& result);
+
+// 서버 측 스냅샷 복제기
+// 틱마다 월드 상태를 캡처해 최근 kSnapshotHistorySize개를 보관하고, 클라이언트별로 확인(ack)된
+// 마지막 스냅샷을 기준으로 변경분만 보낸다. 기준이 없거나 너무 오래되면 전체 상태를 보낸다.
+// 같은 기준을 가진 클라이언트들은 한 번 인코딩한 프레임을 공유한다.
+// 스레드 안전하지 않다 - 게임 루프 스레드에서만 사용한다.
+class SnapshotReplicator {
+public:
+    struct Stats {
+        uint32_t sequence;
+        size_t clients;
+        uint64_t full_frames;
+        uint64_t delta_frames;
+        uint64_t encoded_frames;    // 실제로 인코딩한 수 (나머지는 공유)
+        uint64_t bytes_sent;
+        uint64_t truncated_captures;    // kMaxSnapshotEntities를 넘어 잘린 캡처 수
+        size_t truncated_entities;      // 마지막 캡처에서 잘린 엔티티 수 (0이면 모두 복제)
+    };
+
+    SnapshotReplicator();
+
+    void AddClient(uint32_t client_id);
+    void RemoveClient(uint32_t client_id);
+    void Acknowledge(uint32_t client_id, uint32_t sequence);
+
+    // 새 스냅샷 번호 반환 - state는 id 순으로 정렬되고 kMaxSnapshotEntities에서 잘린다
+    // (잘린 엔티티는 복제되지 않는다 - Stats의 truncated_*로 확인)
+    uint32_t Capture(WorldSnapshot state);
+
+    // 마지막 Capture에 대한 이 클라이언트용 프레임
+    SharedFrame BuildFrame(uint32_t client_id);
+
+    Stats GetStats() const;
+
+private:
+    struct HistoryEntry {
+        uint32_t sequence = 0;
+        std::shared_ptr<const WorldSnapshot> state;
+    };
+
+    // 기준별 프레임 - 델타가 넘쳐 전체 상태로 대신했으면 full
+    struct CachedFrame {
+        SharedFrame frame;
+        bool full = false;
+    };
+
+    const WorldSnapshot* FindSnapshot(uint32_t sequence) const;
+
+    uint32_t sequence_;
+    std::array<HistoryEntry, kSnapshotHistorySize> history_;
+    std::unordered_map<uint32_t, uint32_t> acked_;          // 클라이언트 -> 확인된 스냅샷 번호
+    std::unordered_map<uint32_t, CachedFrame> frame_cache_;  // 기준 번호 -> 현재 스냅샷 프레임
+    Stats stats_;
+};
+
+// 클라이언트 측 - 받은 스냅샷을 기준 상태에 적용해 월드 상태를 복원한다
+class SnapshotReceiver {
+public:
+    // 적용에 성공하면 true와 함께 확인(ack)할 스냅샷 번호를 돌려준다
+    bool Apply(const Packet& packet, uint32_t& sequence);
+
+    const WorldSnapshot& GetState() const { return latest_; }
+    uint32_t GetSequence() const { return latest_sequence_; }
+
+private:
+    struct HistoryEntry {
+        uint32_t sequence = 0;
+        WorldSnapshot state;
+    };
+
+    std::array<HistoryEntry, kSnapshotHistorySize> history_;
+    WorldSnapshot latest_;
+    uint32_t latest_sequence_ = 0;
+};
+
+} // namespace Network
@@ -19,6 +19,17 @@ log_level = INFO
 log_file = logs/auth_server.log
 console_output = true
 file_output = true
+log_async = true
+log_buffer_kb = 256
+log_overflow_policy = block
+log_flush_interval_ms = 100
+log_binary = false
+log_binary_file = logs/auth_server.blog
+log_rotate_size_mb = 100
+log_rotate_interval_min = 1440
+log_retain_files = 10
+log_retain_total_mb = 1024
+log_compress = true
 
 [database]
 host = localhost
@@ -34,6 +45,9 @@ jwt_expiration_hours = 24
 password_hash_rounds = 12
 ssl_enabled = false
 
+[performance]
+io_threads = 2
+
 EOF
 
 
@@ -48,6 +62,17 @@ log_level = INFO
 log_file = logs/gateway_server.log
 console_output = true
 file_output = true
+log_async = true
+log_buffer_kb = 256
+log_overflow_policy = block
+log_flush_interval_ms = 100
+log_binary = false
+log_binary_file = logs/gateway_server.blog
+log_rotate_size_mb = 100
+log_rotate_interval_min = 1440
+log_retain_files = 10
+log_retain_total_mb = 1024
+log_compress = true
 
 [load_balance]
 method = round_robin
@@ -64,6 +89,11 @@ game_servers = localhost:8003
 enabled = true
 requests = 100
 window = 60
+
+[performance]
+io_threads = 4
+send_queue_limit_kb = 256
+send_overflow_policy = disconnect
 EOF
 
 cat > config/game_server.conf << 'EOF'
@@ -77,6 +107,17 @@ log_level = INFO
 log_file = logs/game_server.log
 console_output = true
 file_output = true
+log_async = true
+log_buffer_kb = 256
+log_overflow_policy = block
+log_flush_interval_ms = 100
+log_binary = false
+log_binary_file = logs/game_server.blog
+log_rotate_size_mb = 100
+log_rotate_interval_min = 1440
+log_retain_files = 10
+log_retain_total_mb = 1024
+log_compress = true
 
 [game]
 max_players_per_zone = 100
@@ -90,6 +131,11 @@ worker_threads = 4
 update_queue_size = 1000
 optimized_networking = true
 batch_size = 10
+send_queue_limit_kb = 1024
+send_overflow_policy = disconnect
+tick_catch_up_policy = skip
+max_catch_up_ticks = 5
+job_threads = 0
 
 [zones]
 servers = localhost:8004
@@ -114,11 +160,16 @@ width = 100
 height = 100
 file = maps/zone_1.map
 validation_enabled = true
+view_distance = 50
 
 [npc]
 max_npcs = 200
 spawn_interval = 5
 data_file = data/npcs.json
+path_budget_us = 500
+path_cache_size = 1024
+path_max_search_nodes = 65536
+ai_budget_us = 2000
 
 [instance]
 enabled = false
@@ -129,4 +180,12 @@ timeout = 3600
 tick_rate = 60.0
 collision_enabled = true
 gravity = 9.81
+player_move_speed = 5.0
+network_send_rate = 20.0
+body_radius = 0.35
+
+[performance]
+io_threads = 2
+send_queue_limit_kb = 1024
+send_overflow_policy = drop
 EOF
\ No newline at end of file
@@ -27,6 +27,17 @@ log_level = WARNING
 log_file = /var/log/mmorpg/auth_server.log
 console_output = false
 file_output = true
+log_async = true
+log_buffer_kb = 1024
+log_overflow_policy = block
+log_flush_interval_ms = 100
+log_binary = false
+log_binary_file = /var/log/mmorpg/auth_server.blog
+log_rotate_size_mb = 512
+log_rotate_interval_min = 1440
+log_retain_files = 30
+log_retain_total_mb = 20480
+log_compress = true
 
 [database]
 host = ${DB_AUTH_HOST}
@@ -41,6 +52,9 @@ jwt_secret = ${JWT_SECRET}
 jwt_expiration_hours = 8
 password_hash_rounds = 15
 ssl_enabled = true
+
+[performance]
+io_threads = 4
 EOF
         echo "✓ Production Auth Server config created"
     fi
@@ -55,6 +69,17 @@ log_level = WARNING
 log_file = /var/log/mmorpg/gateway_server.log
 console_output = false
 file_output = true
+log_async = true
+log_buffer_kb = 1024
+log_overflow_policy = block
+log_flush_interval_ms = 100
+log_binary = false
+log_binary_file = /var/log/mmorpg/gateway_server.blog
+log_rotate_size_mb = 512
+log_rotate_interval_min = 1440
+log_retain_files = 30
+log_retain_total_mb = 20480
+log_compress = true
 
 [load_balance]
 method = least_connections
@@ -71,6 +96,11 @@ game_servers = ${GAME_SERVERS}
 enabled = true
 requests = 1000
 window = 60
+
+[performance]
+io_threads = 8
+send_queue_limit_kb = 256
+send_overflow_policy = disconnect
 EOF
         echo "✓ Production Gateway Server config created"
     fi
@@ -86,6 +116,17 @@ log_level = WARNING
 log_file = /var/log/mmorpg/game_server.log
 console_output = false
 file_output = true
+log_async = true
+log_buffer_kb = 1024
+log_overflow_policy = block
+log_flush_interval_ms = 100
+log_binary = false
+log_binary_file = /var/log/mmorpg/game_server.blog
+log_rotate_size_mb = 512
+log_rotate_interval_min = 1440
+log_retain_files = 30
+log_retain_total_mb = 20480
+log_compress = true
 
 [game]
 max_players_per_zone = 200
@@ -99,6 +140,11 @@ worker_threads = 8
 update_queue_size = 5000
 optimized_networking = true
 batch_size = 50
+send_queue_limit_kb = 2048
+send_overflow_policy = disconnect
+tick_catch_up_policy = skip
+max_catch_up_ticks = 5
+job_threads = 0
 
 [zones]
 servers = ${ZONE_SERVERS}
@@ -124,11 +170,16 @@ width = 500
 height = 500
 file = /opt/mmorpg/maps/zone_${ZONE_ID}.map
 validation_enabled = true
+view_distance = 50
 
 [npc]
 max_npcs = 1000
 spawn_interval = 3
 data_file = /opt/mmorpg/data/npcs.json
+path_budget_us = 500
+path_cache_size = 4096
+path_max_search_nodes = 65536
+ai_budget_us = 2000
 
 [instance]
 enabled = true
@@ -139,6 +190,14 @@ timeout = 7200
 tick_rate = 60.0
 collision_enabled = true
 gravity = 9.81
+player_move_speed = 5.0
+network_send_rate = 20.0
+body_radius = 0.35
+
+[performance]
+io_threads = 4
+send_queue_limit_kb = 2048
+send_overflow_policy = drop
 EOF
         echo "✓ Production Zone Server config created"
     fi
@@ -1,5 +1,7 @@
 // test_client/main.cpp - Updated with Logging
 #include "../network/network_manager.h"
+#include "../network/packet_schema.h"
+#include "../network/snapshot_replicator.h"
 #include "../common/log_manager.h"
 #include "../common/config_manager.h"
 #include <iostream>
@@ -58,7 +60,13 @@ public:
                 } else if (command == "login") {
                     SendLogin();
                 } else if (command == "move") {
-                    SendMove();
+                    int dx = (tokens.size() > 1) ? std::stoi(tokens[1]) : 1;
+                    int dy = (tokens.size() > 2) ? std::stoi(tokens[2]) : 0;
+                    SendMove(dx, dy);
+                } else if (command == "walk") {
+                    int dx = (tokens.size() > 1) ? std::stoi(tokens[1]) : 1;
+                    int dy = (tokens.size() > 2) ? std::stoi(tokens[2]) : 0;
+                    SendMoveInput(dx, dy);
                 } else if (command == "chat") {
                     std::string message = (tokens.size() > 1) ?
                         input.substr(input.find(' ') + 1) : "Hello World!";
@@ -153,45 +161,73 @@ private:
 
         switch (packet.type) {
             case Network::PACKET_ECHO: {
-                size_t offset = 0;
-                std::string message = Network::DeserializeString(packet.data, offset);
-                LOG_INFO_FORMAT("CLIENT", "[ECHO] %s", message.c_str());
+                Network::EchoMessage message;
+                if (Network::DecodePacket(packet, message)) {
+                    LOG_INFO_FORMAT("CLIENT", "[ECHO] %s", std::string(message.message).c_str());
+                }
                 break;
             }
             case Network::PACKET_AUTH_RESPONSE: {
-                size_t offset = 0;
-                std::string message = Network::DeserializeString(packet.data, offset);
-                LOG_INFO_FORMAT("CLIENT", "[AUTH] %s", message.c_str());
+                Network::AuthResponse response;
+                if (Network::DecodePacket(packet, response)) {
+                    LOG_INFO_FORMAT("CLIENT", "[AUTH] %s", std::string(response.message).c_str());
+                }
                 break;
             }
             case Network::PACKET_LOGIN_RESPONSE: {
-                size_t offset = 0;
-                std::string message = Network::DeserializeString(packet.data, offset);
-                LOG_INFO_FORMAT("CLIENT", "[LOGIN] %s", message.c_str());
+                Network::LoginResponse response;
+                if (Network::DecodePacket(packet, response)) {
+                    LOG_INFO_FORMAT("CLIENT", "[LOGIN] %s", std::string(response.message).c_str());
+                }
                 break;
             }
             case Network::PACKET_PLAYER_MOVE: {
-                size_t offset = 0;
-                std::string message = Network::DeserializeString(packet.data, offset);
-                LOG_INFO_FORMAT("CLIENT", "[MOVE] %s", message.c_str());
+                Network::PlayerMoveResult result;
+                if (Network::DecodePacket(packet, result)) {
+                    LOG_INFO_FORMAT("CLIENT", "[MOVE] Player %u at (%d, %d)",
+                                   result.player_id, result.x, result.y);
+                }
                 break;
             }
             case Network::PACKET_PLAYER_CHAT: {
-                size_t offset = 0;
-                std::string message = Network::DeserializeString(packet.data, offset);
-                LOG_INFO_FORMAT("CLIENT", "[CHAT] %s", message.c_str());
+                Network::ChatMessage message;
+                if (Network::DecodePacket(packet, message)) {
+                    LOG_INFO_FORMAT("CLIENT", "[CHAT] %s", std::string(message.message).c_str());
+                }
+                break;
+            }
+            case Network::PACKET_ZONE_CHANGE: {
+                Network::ZoneChangeResponse response;
+                if (Network::DecodePacket(packet, response)) {
+                    LOG_INFO_FORMAT("CLIENT", "[ZONE] %s", std::string(response.message).c_str());
+                }
                 break;
             }
             case Network::PACKET_ZONE_DATA: {
-                size_t offset = 0;
-                std::string message = Network::DeserializeString(packet.data, offset);
-                LOG_INFO_FORMAT("CLIENT", "[ZONE] %s", message.c_str());
+                Network::ZoneDataResponse response;
+                if (Network::DecodePacket(packet, response)) {
+                    LOG_INFO_FORMAT("CLIENT", "[ZONE] Zone %d, size %dx%d",
+                                   response.zone_id, response.width, response.height);
+                }
+                break;
+            }
+            case Network::PACKET_SNAPSHOT: {
+                // 기준 상태에 변경분을 적용하고 확인 응답 - 이후 서버는 이 스냅샷 대비 델타를 보낸다
+                uint32_t sequence;
+                if (snapshot_receiver_.Apply(packet, sequence)) {
+                    connection_->Send(Network::EncodePacket(Network::SnapshotAck{sequence}));
+                    snapshot_sequence_ = sequence;
+                    snapshot_entities_ = snapshot_receiver_.GetState().size();
+                    LOG_DEBUG_FORMAT("CLIENT", "[SNAPSHOT] #%u, %zu entities (%d bytes)",
+                                    sequence, snapshot_receiver_.GetState().size(), packet.size);
+                }
                 break;
             }
             case Network::PACKET_GAME_DATA: {
-                size_t offset = 0;
-                std::string message = Network::DeserializeString(packet.data, offset);
-                LOG_INFO_FORMAT("CLIENT", "[GAME] %s", message.c_str());
+                Network::GameDataMessage message;
+                if (Network::DecodePacket(packet, message)) {
+                    LOG_INFO_FORMAT("CLIENT", "[GAME] %s", std::string(message.message).c_str());
+                }
                 break;
             }
             default:
@@ -203,8 +239,7 @@ private:
     void SendEcho(const std::string& message) {
         if (!CheckConnection()) return;
 
-        auto data = Network::SerializeString(message);
-        Network::Packet packet(Network::PACKET_ECHO, data);
+        Network::Packet packet = Network::EncodePacket(Network::EchoMessage{message});
         if (connection_->Send(packet)) {
             LOG_DEBUG_FORMAT("CLIENT", "Sent echo: %s", message.c_str());
         } else {
@@ -215,9 +250,7 @@ private:
     void SendAuth() {
         if (!CheckConnection()) return;
 
-        std::string auth_data = "test_user:test_password";
-        auto data = Network::SerializeString(auth_data);
-        Network::Packet packet(Network::PACKET_AUTH_REQUEST, data);
+        Network::Packet packet = Network::EncodePacket(Network::AuthRequest{"test_user", "test_password"});
         if (connection_->Send(packet)) {
             LOG_DEBUG("CLIENT", "Sent authentication request");
         } else {
@@ -228,9 +261,7 @@ private:
     void SendLogin() {
         if (!CheckConnection()) return;
 
-        std::string login_data = "test_user";
-        auto data = Network::SerializeString(login_data);
-        Network::Packet packet(Network::PACKET_LOGIN_REQUEST, data);
+        Network::Packet packet = Network::EncodePacket(Network::LoginRequest{"test_user"});
         if (connection_->Send(packet)) {
             LOG_DEBUG("CLIENT", "Sent login request");
         } else {
@@ -238,24 +269,34 @@ private:
         }
     }
 
-    void SendMove() {
+    void SendMove(int dx, int dy) {
         if (!CheckConnection()) return;
 
-        std::string move_data = "move_right";
-        auto data = Network::SerializeString(move_data);
-        Network::Packet packet(Network::PACKET_PLAYER_MOVE, data);
+        Network::PlayerMoveRequest move{static_cast<int16_t>(dx), static_cast<int16_t>(dy)};
+        Network::Packet packet = Network::EncodePacket(move);
         if (connection_->Send(packet)) {
-            LOG_DEBUG("CLIENT", "Sent move command");
+            LOG_DEBUG_FORMAT("CLIENT", "Sent move command (%d, %d)", dx, dy);
         } else {
             LOG_ERROR("CLIENT", "Failed to send move command");
         }
     }
 
+    void SendMoveInput(int dx, int dy) {
+        if (!CheckConnection()) return;
+
+        Network::PlayerMoveInput input{static_cast<int16_t>(dx), static_cast<int16_t>(dy)};
+        Network::Packet packet = Network::EncodePacket(input);
+        if (connection_->Send(packet)) {
+            LOG_DEBUG_FORMAT("CLIENT", "Sent move input (%d, %d)", dx, dy);
+        } else {
+            LOG_ERROR("CLIENT", "Failed to send move input");
+        }
+    }
+
     void SendChat(const std::string& message) {
         if (!CheckConnection()) return;
 
-        auto data = Network::SerializeString(message);
-        Network::Packet packet(Network::PACKET_PLAYER_CHAT, data);
+        Network::Packet packet = Network::EncodePacket(Network::ChatMessage{message});
         if (connection_->Send(packet)) {
             LOG_DEBUG_FORMAT("CLIENT", "Sent chat: %s", message.c_str());
         } else {
@@ -266,9 +307,7 @@ private:
     void SendZoneRequest() {
         if (!CheckConnection()) return;
 
-        std::string zone_request = "request_zone_data";
-        auto data = Network::SerializeString(zone_request);
-        Network::Packet packet(Network::PACKET_ZONE_DATA, data);
+        Network::Packet packet = Network::EncodePacket(Network::ZoneDataRequest{});
         if (connection_->Send(packet)) {
             LOG_DEBUG("CLIENT", "Sent zone data request");
         } else {
@@ -324,6 +363,8 @@ private:
             LOG_INFO("CLIENT", "Connection Status: Disconnected");
         }
         LOG_INFO_FORMAT("CLIENT", "Receive Thread Active: %s", receiving_ ? "Yes" : "No");
+        LOG_INFO_FORMAT("CLIENT", "Last Snapshot: #%u (%zu entities)",
+                       snapshot_sequence_.load(), snapshot_entities_.load());
     }
 
     void PrintCommands() {
@@ -333,7 +374,8 @@ private:
         std::cout << "echo <message>         - Send echo message" << std::endl;
         std::cout << "auth                   - Send authentication request" << std::endl;
         std::cout << "login                  - Send login request" << std::endl;
-        std::cout << "move                   - Send move command" << std::endl;
+        std::cout << "move [dx] [dy]         - Send move command (default: 1 0)" << std::endl;
+        std::cout << "walk [dx] [dy]         - Walk in a direction in a zone, 0 0 stops (default: 1 0)" << std::endl;
         std::cout << "chat <message>         - Send chat message" << std::endl;
         std::cout << "zone                   - Request zone data" << std::endl;
         std::cout << "spam <count>           - Send multiple echo messages" << std::endl;
@@ -387,6 +429,9 @@ private:
     std::shared_ptr<Network::Connection> connection_;
     std::thread receive_thread_;
     std::atomic<bool> receiving_;
+    Network::SnapshotReceiver snapshot_receiver_;   // 수신 스레드 전용
+    std::atomic<uint32_t> snapshot_sequence_{0};
+    std::atomic<size_t> snapshot_entities_{0};
 };
 
 int main() {
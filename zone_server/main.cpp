@@ -1,37 +1,89 @@
 // zone_server/main.cpp
 #include "../network/network_manager.h"
+#include "../network/packet_schema.h"
+#include "../network/packet_dispatcher.h"
+#include "../common/config_manager.h"
+#include "../common/entity_store.h"
+#include "../common/spatial_grid.h"
+#include "../common/tick_scheduler.h"
+#include "../common/movement_kernel.h"
+#include "../common/collision_map.h"
+#include "../common/path_finder.h"
+#include "../common/broadphase.h"
+#include "npc_manager.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
 #include <iostream>
+#include <sstream>
+#include <memory>
 #include <string>
 #include <chrono>
 #include <thread>
-#include <map>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 class ZoneServer {
 public:
-    ZoneServer() : port_(8004), zone_id_(1) {}
+    ZoneServer()
+        : path_budget_(0)
+        , tick_scheduler_(static_cast<int>(Common::ZoneServerConfig::GetPhysicsTickRate()),
+                          Common::TickCatchUpPolicy::SKIP)
+        , network_scheduler_(static_cast<int>(Common::ZoneServerConfig::GetNetworkSendRate()),
+                             Common::TickCatchUpPolicy::SKIP)
+        , zone_running_(false) {
+        // 설정은 main()에서 먼저 로드한다 - 위 스케줄러들이 초기화 목록에서 틱 레이트를 읽는다
+        port_ = Common::ZoneServerConfig::GetPort();
+        max_connections_ = Common::ZoneServerConfig::GetMaxConnections();
+        zone_id_ = Common::ZoneServerConfig::GetZoneId();
+        view_distance_ = Common::ZoneServerConfig::GetViewDistance();
+        move_speed_ = static_cast<float>(Common::ZoneServerConfig::GetPlayerMoveSpeed());
+        collision_enabled_ = Common::ZoneServerConfig::GetCollisionEnabled();
+        body_radius_ = static_cast<float>(Common::ZoneServerConfig::GetBodyRadius());
+    }
 
     bool Initialize() {
-        if (!network_manager_.InitializeServer(port_)) {
+        if (!network_manager_.InitializeServer(port_, max_connections_,
+                                               Common::ZoneServerConfig::GetIoThreads())) {
             std::cerr << "Failed to initialize Zone Server on port " << port_ << std::endl;
             return false;
         }
+        network_manager_.SetSendQueueLimit(
+            static_cast<size_t>(Common::ZoneServerConfig::GetSendQueueLimitKb()) * 1024,
+            Network::ParseSendOverflowPolicy(Common::ZoneServerConfig::GetSendOverflowPolicy()));
 
         // 콜백 설정
         network_manager_.SetOnClientConnected([this](std::shared_ptr<Network::Connection> conn) {
             std::cout << "[ZONE-" << zone_id_ << "] Player entered zone: " << conn->GetAddress() << std::endl;
             // 존 플레이어 추가
-            zone_players_[conn->GetId()] = {conn->GetId(), conn->GetAddress(), 100, 100};
+            std::lock_guard<std::mutex> lock(zone_mutex_);
+            ZonePosition spawn{std::min(100, map_width_ - 2), std::min(100, map_height_ - 2)};
+            ZoneBody body{spawn.x + 0.5f, spawn.y + 0.5f};
+            Common::EntityHandle handle = zone_players_.Create(
+                spawn, body, ZonePreviousBody{body.x, body.y}, ZoneVelocity{0.0f, 0.0f}, ZoneLink{conn},
+                ZonePlayerInfo{conn->GetId(), conn->GetAddress()});
+            player_handles_[conn->GetId()] = handle;
+            spatial_grid_->Insert(handle, spawn.x, spawn.y);
         });
 
         network_manager_.SetOnClientDisconnected([this](std::shared_ptr<Network::Connection> conn) {
             std::cout << "[ZONE-" << zone_id_ << "] Player left zone: " << conn->GetAddress() << std::endl;
             // 존 플레이어 제거
-            zone_players_.erase(conn->GetId());
+            std::lock_guard<std::mutex> lock(zone_mutex_);
+            auto it = player_handles_.find(conn->GetId());
+            if (it != player_handles_.end()) {
+                const ZonePosition& position = *zone_players_.Find<ZonePosition>(it->second);
+                spatial_grid_->Remove(it->second, position.x, position.y);
+                zone_players_.Destroy(it->second);
+                player_handles_.erase(it);
+            }
         });
 
+        RegisterHandlers();
         network_manager_.SetOnPacketReceived([this](std::shared_ptr<Network::Connection> conn, const Network::Packet& packet) {
-            HandlePacket(conn, packet);
+            dispatcher_.Dispatch(conn, packet);
         });
 
         // 존 맵 초기화 (간단한 예시)
@@ -44,6 +96,10 @@ public:
         std::cout << "Starting Zone Server [Zone " << zone_id_ << "] on port " << port_ << std::endl;
         network_manager_.StartServer();
 
+        zone_running_ = true;
+        zone_thread_ = std::thread(&ZoneServer::ZoneLoop, this);
+        network_thread_ = std::thread(&ZoneServer::NetworkLoop, this);
+
         std::string input;
         while (std::getline(std::cin, input)) {
             if (input == "quit" || input == "exit") {
@@ -52,53 +108,157 @@ public:
                 std::cout << "Zone ID: " << zone_id_ << std::endl;
                 std::cout << "Players in zone: " << network_manager_.GetConnectionCount() << std::endl;
                 std::cout << "Map size: " << map_width_ << "x" << map_height_ << std::endl;
+                std::cout << "View distance: " << view_distance_ << " (grid cells: "
+                          << spatial_grid_->GetCellCount() << ")" << std::endl;
+                std::cout << "Movement kernel: " << Common::MovementKernelName(Common::DetectMovementKernel())
+                          << ", move speed: " << move_speed_ << " tiles/s" << std::endl;
+                std::cout << "Physics tick: " << tick_scheduler_.GetStats().Describe() << std::endl;
+                std::cout << "Network tick: " << network_scheduler_.GetStats().Describe() << std::endl;
+                PrintStageTimings();
+                PrintPathStats();
+                PrintNpcStats();
+                for (const auto& stats : dispatcher_.GetStats()) {
+                    std::cout << "Packet " << stats.Describe() << std::endl;
+                }
+                std::cout << "Unknown packets dropped: " << dispatcher_.GetUnknownCount()
+                          << " (last type " << dispatcher_.GetLastUnknownType() << ")" << std::endl;
             } else if (input == "players") {
-                for (const auto& [id, player] : zone_players_) {
-                    std::cout << "Player ID: " << id << ", Address: " << player.address
-                              << ", Zone Pos: (" << player.zone_x << ", " << player.zone_y << ")" << std::endl;
+                std::lock_guard<std::mutex> lock(zone_mutex_);
+                const auto& positions = zone_players_.Column<ZonePosition>();
+                const auto& infos = zone_players_.Column<ZonePlayerInfo>();
+                for (size_t i = 0; i < zone_players_.Size(); ++i) {
+                    std::cout << "Player ID: " << infos[i].player_id << ", Address: " << infos[i].address
+                              << ", Zone Pos: (" << positions[i].x << ", " << positions[i].y << ")" << std::endl;
                 }
             } else if (input == "map") {
                 std::cout << "Zone Map Layout:" << std::endl;
                 PrintZoneMap();
+            } else if (input.rfind("path ", 0) == 0) {
+                RequestDebugPath(input);
             }
         }
 
+        zone_running_ = false;
+        if (zone_thread_.joinable()) {
+            zone_thread_.join();
+        }
+        if (network_thread_.joinable()) {
+            network_thread_.join();
+        }
         network_manager_.StopServer();
     }
 
 private:
-    struct ZonePlayer {
+    // 존 플레이어 컴포넌트 - 위치는 빽빽한 열로, 주소 같은 정보는 별도 열로
+    // ZonePosition은 클라이언트에 알린 격자 위치, ZoneBody/ZoneVelocity는 이동 커널이 적분하는 연속 좌표,
+    // ZonePreviousBody는 직전 물리 틱의 위치 (네트워크 틱이 두 물리 상태 사이를 보간한다)
+    struct ZonePosition {
+        int32_t x, y;
+    };
+
+    struct ZoneBody {
+        float x, y;
+    };
+
+    struct ZonePreviousBody {
+        float x, y;
+    };
+
+    struct ZoneVelocity {
+        float x, y;     // 초당 타일
+    };
+
+    // 이동 커널은 열을 (x, y) float 쌍 배열로 읽는다
+    static_assert(sizeof(ZoneBody) == 2 * sizeof(float), "ZoneBody must be a packed float pair");
+    static_assert(sizeof(ZoneVelocity) == 2 * sizeof(float), "ZoneVelocity must be a packed float pair");
+
+    struct ZoneLink {
+        std::shared_ptr<Network::Connection> connection;
+    };
+
+    struct ZonePlayerInfo {
         uint32_t player_id;
         std::string address;
-        int32_t zone_x, zone_y;
+    };
+
+    using ZonePlayerStore =
+        Common::EntityStore<ZonePosition, ZoneBody, ZonePreviousBody, ZoneVelocity, ZoneLink, ZonePlayerInfo>;
+
+    // 존 틱 단계 - 앞의 넷은 물리 틱, 뒤의 둘은 네트워크 틱
+    enum Stage {
+        STAGE_PATHS,
+        STAGE_NPCS,
+        STAGE_INTEGRATE,
+        STAGE_COLLISION,
+        STAGE_PUBLISH,      // 보간 + 격자 위치/AOI 갱신 + 전송 대상 수집
+        STAGE_SEND,
+        STAGE_COUNT
+    };
+
+    // 단계마다 기록하는 스레드가 하나뿐이라 max도 load/store로 충분하다
+    struct StageTiming {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> max_ns{0};
     };
 
     void InitializeZoneMap() {
-        map_width_ = 50;
-        map_height_ = 50;
-
-        // 간단한 맵 생성 (실제로는 파일에서 로드)
-        zone_map_.resize(map_height_);
-        for (int y = 0; y < map_height_; ++y) {
-            zone_map_[y].resize(map_width_);
-            for (int x = 0; x < map_width_; ++x) {
-                // 경계는 벽, 나머지는 빈 공간
-                if (x == 0 || x == map_width_ - 1 || y == 0 || y == map_height_ - 1) {
-                    zone_map_[y][x] = '#'; // 벽
-                } else {
-                    zone_map_[y][x] = '.'; // 빈 공간
+        // 바이너리 충돌 맵을 mmap - 파일이 없거나 깨졌으면 기본 맵(경계만 벽)을 만들어 저장한 뒤 다시 연다
+        std::string map_file = Common::ZoneServerConfig::GetMapFile();
+        bool validate = Common::ZoneServerConfig::GetMapValidationEnabled();
+        if (!collision_map_.Load(map_file, validate)) {
+            std::cout << "[ZONE-" << zone_id_ << "] Map file " << map_file << " unavailable ("
+                      << collision_map_.GetError() << "), generating default map" << std::endl;
+
+            Common::CollisionMap generated;
+            generated.Create(Common::ZoneServerConfig::GetMapWidth(), Common::ZoneServerConfig::GetMapHeight());
+            for (int y = 0; y < generated.GetHeight(); ++y) {
+                for (int x = 0; x < generated.GetWidth(); ++x) {
+                    if (x == 0 || x == generated.GetWidth() - 1 || y == 0 || y == generated.GetHeight() - 1) {
+                        generated.SetWalkable(x, y, false); // 벽
+                    }
                 }
             }
+            if (!generated.Save(map_file) || !collision_map_.Load(map_file, validate)) {
+                std::cerr << "[ZONE-" << zone_id_ << "] Failed to write " << map_file
+                          << ", using in-memory map" << std::endl;
+                collision_map_ = std::move(generated);
+            }
+        }
+        map_width_ = collision_map_.GetWidth();
+        map_height_ = collision_map_.GetHeight();
+
+        path_service_ = std::make_unique<Common::PathService>(
+            collision_map_,
+            static_cast<size_t>(std::max(0, Common::ZoneServerConfig::GetPathCacheSize())),
+            static_cast<size_t>(std::max(1, Common::ZoneServerConfig::GetPathMaxSearchNodes())));
+        path_budget_ = std::chrono::microseconds(std::max(1, Common::ZoneServerConfig::GetPathBudgetUs()));
+
+        npc_manager_ = std::make_unique<NpcManager>(
+            collision_map_, *path_service_,
+            Common::ZoneServerConfig::GetMaxNpcs(),
+            Common::ZoneServerConfig::GetNpcSpawnInterval(),
+            view_distance_,
+            std::chrono::microseconds(std::max(1, Common::ZoneServerConfig::GetNpcAiBudgetUs())));
+        std::string npc_file = Common::ZoneServerConfig::GetNpcDataFile();
+        if (!npc_manager_->LoadTemplates(npc_file)) {
+            std::cerr << "[ZONE-" << zone_id_ << "] Failed to load " << npc_file
+                      << ", using default NPC templates" << std::endl;
         }
 
-        std::cout << "[ZONE-" << zone_id_ << "] Map initialized: " << map_width_ << "x" << map_height_ << std::endl;
+        // 셀 크기를 시야 거리로 잡아 AOI 질의가 주변 3x3 셀만 보도록 한다
+        spatial_grid_ = std::make_unique<Common::SpatialGrid>(map_width_, map_height_, view_distance_);
+
+        std::cout << "[ZONE-" << zone_id_ << "] Map initialized: " << map_width_ << "x" << map_height_
+                  << (collision_map_.IsMapped() ? " (mapped " : " (in-memory ") << map_file << ", "
+                  << collision_map_.GetByteSize() / 1024 << " KB)" << std::endl;
     }
 
     void PrintZoneMap() {
         // 맵의 일부만 출력 (10x10)
         for (int y = 0; y < std::min(10, map_height_); ++y) {
             for (int x = 0; x < std::min(10, map_width_); ++x) {
-                std::cout << zone_map_[y][x];
+                std::cout << (collision_map_.IsWalkable(x, y) ? '.' : '#');
             }
             std::cout << std::endl;
         }
@@ -107,74 +267,335 @@ private:
         }
     }
 
-    void HandlePacket(std::shared_ptr<Network::Connection> conn, const Network::Packet& packet) {
-        switch (packet.type) {
-            case Network::PACKET_ECHO: {
-                // 에코 응답
-                std::string message = "ZONE_ECHO_RESPONSE_ZONE_" + std::to_string(zone_id_);
-                auto response_data = Network::SerializeString(message);
-                Network::Packet response(Network::PACKET_ECHO, response_data);
-                network_manager_.SendToClient(conn, response);
-                std::cout << "[ZONE-" << zone_id_ << "] Echo request from " << conn->GetAddress() << std::endl;
-                break;
+    void PrintPathStats() {
+        std::lock_guard<std::mutex> lock(zone_mutex_);
+        Common::PathService::Stats stats = path_service_->GetStats();
+        std::cout << "Paths: requests=" << stats.requests << " cache_hits=" << stats.cache_hits
+                  << " found=" << stats.found << " not_found=" << stats.not_found
+                  << " limit_reached=" << stats.limit_reached
+                  << " cancelled=" << stats.cancelled << " expanded=" << stats.expanded_nodes
+                  << " pending=" << stats.pending << " cached=" << stats.cached
+                  << " over_budget_ticks=" << stats.budget_exhausted
+                  << " max_update=" << stats.max_update_us << "us" << std::endl;
+    }
+
+    void PrintNpcStats() {
+        std::lock_guard<std::mutex> lock(zone_mutex_);
+        std::cout << "NPCs: " << npc_manager_->GetStats().Describe() << std::endl;
+    }
+
+    // 콘솔 디버그용 - "path sx sy gx gy"
+    void RequestDebugPath(const std::string& input) {
+        std::istringstream stream(input.substr(5));
+        Common::PathPoint start, goal;
+        if (!(stream >> start.x >> start.y >> goal.x >> goal.y)) {
+            std::cout << "Usage: path <sx> <sy> <gx> <gy>" << std::endl;
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(zone_mutex_);
+        path_service_->Request(start, goal, [this](uint32_t id, const Common::PathResult& result) {
+            std::cout << "[ZONE-" << zone_id_ << "] Path #" << id << ": ";
+            if (result.status != Common::PathStatus::FOUND) {
+                std::cout << (result.status == Common::PathStatus::LIMIT_REACHED ? "search node limit reached"
+                                                                                  : "not found") << std::endl;
+                return;
             }
-            case Network::PACKET_ZONE_CHANGE: {
-                // 존 변경 요청 처리
-                std::string zone_response = "ZONE_CHANGE_SUCCESS";
-                auto response_data = Network::SerializeString(zone_response);
-                Network::Packet response(Network::PACKET_ZONE_CHANGE, response_data);
-                network_manager_.SendToClient(conn, response);
-                std::cout << "[ZONE-" << zone_id_ << "] Zone change request from " << conn->GetAddress() << std::endl;
-                break;
+            for (const Common::PathPoint& point : *result.path) {
+                std::cout << "(" << point.x << ", " << point.y << ") ";
             }
-            case Network::PACKET_ZONE_DATA: {
-                // 존 데이터 요청 처리
-                std::string zone_data = "ZONE_DATA_ZONE_" + std::to_string(zone_id_) + "_SIZE_" +
-                                       std::to_string(map_width_) + "x" + std::to_string(map_height_);
-                auto response_data = Network::SerializeString(zone_data);
-                Network::Packet response(Network::PACKET_ZONE_DATA, response_data);
-                network_manager_.SendToClient(conn, response);
-                std::cout << "[ZONE-" << zone_id_ << "] Zone data request from " << conn->GetAddress() << std::endl;
-                break;
+            std::cout << (result.from_cache ? "[cached]" : "") << std::endl;
+        });
+    }
+
+    void RegisterHandlers() {
+        using ConnectionPtr = Network::PacketDispatcher::ConnectionPtr;
+
+        dispatcher_.Register<Network::EchoMessage>([this](const ConnectionPtr& conn, const Network::EchoMessage&) {
+            // 에코 응답
+            std::string message = "ZONE_ECHO_RESPONSE_ZONE_" + std::to_string(zone_id_);
+            network_manager_.SendToClient(conn, Network::EncodePacket(Network::EchoMessage{message}));
+            std::cout << "[ZONE-" << zone_id_ << "] Echo request from " << conn->GetAddress() << std::endl;
+        });
+
+        dispatcher_.Register<Network::ZoneChangeRequest>([this](const ConnectionPtr& conn, const Network::ZoneChangeRequest&) {
+            // 존 변경 요청 처리
+            network_manager_.SendToClient(conn, Network::EncodePacket(Network::ZoneChangeResponse{"ZONE_CHANGE_SUCCESS"}));
+            std::cout << "[ZONE-" << zone_id_ << "] Zone change request from " << conn->GetAddress() << std::endl;
+        });
+
+        dispatcher_.Register<Network::ZoneDataRequest>([this](const ConnectionPtr& conn, const Network::ZoneDataRequest&) {
+            // 존 데이터 요청 처리
+            Network::ZoneDataResponse zone_data{zone_id_, map_width_, map_height_};
+            network_manager_.SendToClient(conn, Network::EncodePacket(zone_data));
+            std::cout << "[ZONE-" << zone_id_ << "] Zone data request from " << conn->GetAddress() << std::endl;
+        });
+
+        // 존은 속도 기반 이동만 받는다 - 한 번 적용하는 변화량(PlayerMoveRequest)은 게임 서버 전용
+        dispatcher_.Register<Network::PlayerMoveInput>([this](const ConnectionPtr& conn, const Network::PlayerMoveInput& input) {
+            HandlePlayerMoveInput(conn, input);
+        });
+    }
+
+    void HandlePlayerMoveInput(const std::shared_ptr<Network::Connection>& conn, const Network::PlayerMoveInput& input) {
+        // 다음 입력까지 유지되는 방향 - 실제 이동은 존 틱에서 일괄 적분한다 ((0, 0)이면 정지)
+        {
+            std::lock_guard<std::mutex> lock(zone_mutex_);
+            auto it = player_handles_.find(conn->GetId());
+            if (it == player_handles_.end()) {
+                return;
+            }
+
+            ZoneVelocity& velocity = *zone_players_.Find<ZoneVelocity>(it->second);
+            float length = std::sqrt(float(input.dir_x) * input.dir_x + float(input.dir_y) * input.dir_y);
+            if (length > 0.0f) {
+                velocity.x = input.dir_x / length * move_speed_;
+                velocity.y = input.dir_y / length * move_speed_;
+            } else {
+                velocity = ZoneVelocity{0.0f, 0.0f};
+            }
+        }
+
+        std::cout << "[ZONE-" << zone_id_ << "] Player move in zone from " << conn->GetAddress() << std::endl;
+    }
+
+    void ZoneLoop() {
+        std::cout << "[ZONE-" << zone_id_ << "] Zone simulation running at " << tick_scheduler_.GetTickRate()
+                  << " TPS, network sends at " << network_scheduler_.GetTickRate()
+                  << "/s (movement kernel: " << Common::MovementKernelName(Common::DetectMovementKernel())
+                  << ", collision " << (collision_enabled_ ? "on" : "off") << ")" << std::endl;
+
+        tick_scheduler_.Start();
+        while (zone_running_) {
+            int ticks = tick_scheduler_.WaitForNextTick();
+            for (int i = 0; i < ticks && zone_running_; ++i) {
+                tick_scheduler_.BeginTick();
+                SimulateZone(1.0f / tick_scheduler_.GetTickRate());
+                tick_scheduler_.EndTick();
             }
-            case Network::PACKET_PLAYER_MOVE: {
-                // 존 내 플레이어 이동 처리
-                if (zone_players_.find(conn->GetId()) != zone_players_.end()) {
-                    // 실제로는 패킷에서 좌표를 파싱하고 충돌 검사를 해야 함
-                    auto& player = zone_players_[conn->GetId()];
-                    player.zone_x = std::max(1, std::min(map_width_ - 2, player.zone_x + 1));
-                    player.zone_y = std::max(1, std::min(map_height_ - 2, player.zone_y + 1));
-
-                    std::string move_response = "ZONE_MOVE_SUCCESS";
-                    auto response_data = Network::SerializeString(move_response);
-                    Network::Packet response(Network::PACKET_PLAYER_MOVE, response_data);
-                    network_manager_.SendToClient(conn, response);
-
-                    // 주변 플레이어들에게 위치 동기화 (간단한 브로드캐스트)
-                    std::string sync_message = "PLAYER_POSITION_SYNC";
-                    auto sync_data = Network::SerializeString(sync_message);
-                    Network::Packet sync_packet(Network::PACKET_GAME_DATA, sync_data);
-                    network_manager_.SendToAll(sync_packet);
-
-                    std::cout << "[ZONE-" << zone_id_ << "] Player move in zone from " << conn->GetAddress() << std::endl;
+        }
+    }
+
+    // 위치 전송은 물리 틱과 별도 스레드에서 더 낮은 주기로 - 밀린 전송은 몰아서 하지 않고 최신 상태만 보낸다
+    void NetworkLoop() {
+        network_scheduler_.Start();
+        while (zone_running_) {
+            network_scheduler_.WaitForNextTick();
+            network_scheduler_.BeginTick();
+            PublishState();
+            network_scheduler_.EndTick();
+        }
+    }
+
+    void RecordStage(Stage stage, std::chrono::steady_clock::time_point start) {
+        uint64_t elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+        StageTiming& timing = stage_timings_[stage];
+        timing.count.fetch_add(1, std::memory_order_relaxed);
+        timing.total_ns.fetch_add(elapsed, std::memory_order_relaxed);
+        if (elapsed > timing.max_ns.load(std::memory_order_relaxed)) {
+            timing.max_ns.store(elapsed, std::memory_order_relaxed);
+        }
+    }
+
+    void PrintStageTimings() {
+        static const char* const kStageNames[STAGE_COUNT] = {
+            "paths", "npcs", "integrate", "collision", "publish", "send"
+        };
+        for (int stage = 0; stage < STAGE_COUNT; ++stage) {
+            const StageTiming& timing = stage_timings_[stage];
+            uint64_t count = timing.count.load(std::memory_order_relaxed);
+            double avg_us = count ? timing.total_ns.load(std::memory_order_relaxed) / 1000.0 / count : 0.0;
+            std::cout << "Stage " << kStageNames[stage] << ": runs=" << count << " avg=" << avg_us << "us max="
+                      << timing.max_ns.load(std::memory_order_relaxed) / 1000.0 << "us" << std::endl;
+        }
+
+        std::lock_guard<std::mutex> lock(zone_mutex_);
+        std::cout << "Collision: bodies=" << collision_bodies_ << " pairs=" << collision_pairs_
+                  << " resolved=" << collision_resolved_ << " full_sorts=" << broadphase_.GetFullSorts() << std::endl;
+    }
+
+    void SimulateZone(float dt) {
+        std::lock_guard<std::mutex> lock(zone_mutex_);
+
+        // 경로 질의는 틱당 예산만큼만 처리하고 나머지는 다음 틱으로
+        auto stage_start = std::chrono::steady_clock::now();
+        path_service_->Update(path_budget_);
+        RecordStage(STAGE_PATHS, stage_start);
+
+        // NPC AI는 플레이어 주변일수록 자주 생각한다 - 플레이어가 없으면 모두 잠든다
+        stage_start = std::chrono::steady_clock::now();
+        player_points_.clear();
+        for (const ZonePosition& position : zone_players_.Column<ZonePosition>()) {
+            player_points_.push_back(Common::PathPoint{position.x, position.y});
+        }
+        npc_manager_->Update(dt, player_points_);
+        RecordStage(STAGE_NPCS, stage_start);
+
+        // 모든 플레이어를 한 번에 적분 + 경계 클램프 + 통행 검사 (보간용으로 적분 전 위치를 남긴다)
+        stage_start = std::chrono::steady_clock::now();
+        if (!zone_players_.Empty()) {
+            auto& bodies = zone_players_.Column<ZoneBody>();
+            auto& previous = zone_players_.Column<ZonePreviousBody>();
+            for (size_t i = 0; i < bodies.size(); ++i) {
+                previous[i] = ZonePreviousBody{bodies[i].x, bodies[i].y};
+            }
+
+            const auto& velocities = zone_players_.Column<ZoneVelocity>();
+            Common::MovementBatch batch{};
+            batch.positions = reinterpret_cast<float*>(bodies.data());
+            batch.velocities = reinterpret_cast<const float*>(velocities.data());
+            batch.count = bodies.size();
+            batch.dt = dt;
+            batch.min_x = 1.0f;
+            batch.min_y = 1.0f;
+            batch.max_x = static_cast<float>(map_width_ - 2);
+            batch.max_y = static_cast<float>(map_height_ - 2);
+            batch.collision = collision_enabled_ ? &collision_map_ : nullptr;
+            Common::IntegrateMovement(batch);
+        }
+        RecordStage(STAGE_INTEGRATE, stage_start);
+
+        if (collision_enabled_) {
+            stage_start = std::chrono::steady_clock::now();
+            ResolveCollisions();
+            RecordStage(STAGE_COLLISION, stage_start);
+        }
+
+        last_simulated_ = std::chrono::steady_clock::now();
+    }
+
+    // 플레이어와 NPC를 한 배열로 모아 sweep-and-prune으로 겹친 쌍을 찾고 서로 밀어낸다
+    void ResolveCollisions() {
+        size_t player_count = zone_players_.Size();
+        size_t npc_count = npc_manager_->GetCount();
+        collision_bodies_ = player_count + npc_count;
+        if (collision_bodies_ < 2) {
+            collision_pairs_ = collision_resolved_ = 0;
+            return;
+        }
+
+        float* players = reinterpret_cast<float*>(zone_players_.Column<ZoneBody>().data());
+        float* npcs = npc_manager_->GetPositions();
+        collision_positions_.resize(collision_bodies_ * 2);
+        std::copy(players, players + player_count * 2, collision_positions_.begin());
+        std::copy(npcs, npcs + npc_count * 2, collision_positions_.begin() + player_count * 2);
+
+        const auto& pairs = broadphase_.FindPairs(collision_positions_.data(), collision_bodies_, body_radius_);
+        collision_pairs_ = pairs.size();
+        collision_resolved_ = Common::ResolveOverlaps(collision_positions_.data(), pairs, body_radius_, &collision_map_);
+
+        std::copy(collision_positions_.begin(), collision_positions_.begin() + player_count * 2, players);
+        std::copy(collision_positions_.begin() + player_count * 2, collision_positions_.end(), npcs);
+    }
+
+    void PublishState() {
+        auto stage_start = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(zone_mutex_);
+            if (zone_players_.Empty()) {
+                RecordStage(STAGE_PUBLISH, stage_start);
+                return;
+            }
+
+            // 전송 시점은 물리 틱 사이 어딘가 - 직전 두 물리 상태를 보간해 한 물리 틱 늦은 매끄러운 위치를 쓴다
+            float alpha = std::chrono::duration<float>(stage_start - last_simulated_).count() *
+                          static_cast<float>(tick_scheduler_.GetTickRate());
+            alpha = std::min(std::max(alpha, 0.0f), 1.0f);
+
+            // 격자 셀이 바뀐 플레이어만 AOI 갱신과 알림 대상 (전송은 락 밖에서)
+            const auto& bodies = zone_players_.Column<ZoneBody>();
+            const auto& previous = zone_players_.Column<ZonePreviousBody>();
+            auto& positions = zone_players_.Column<ZonePosition>();
+            const auto& links = zone_players_.Column<ZoneLink>();
+            for (size_t i = 0; i < bodies.size(); ++i) {
+                int32_t x = static_cast<int32_t>(previous[i].x + (bodies[i].x - previous[i].x) * alpha);
+                int32_t y = static_cast<int32_t>(previous[i].y + (bodies[i].y - previous[i].y) * alpha);
+                if (x == positions[i].x && y == positions[i].y) {
+                    continue;
                 }
-                break;
+
+                Common::EntityHandle handle = zone_players_.HandleAt(i);
+                spatial_grid_->Move(handle, positions[i].x, positions[i].y, x, y);
+                positions[i] = ZonePosition{x, y};
+
+                const auto& connection = links[i].connection;
+                move_results_.emplace_back(connection, Network::PlayerMoveResult{connection->GetId(), x, y});
+
+                // 시야 거리 안의 다른 플레이어만 수집
+                spatial_grid_->QueryRadius(x, y, view_distance_, [&](const Common::SpatialGrid::Entry& entry) {
+                    if (entry.handle != handle) {
+                        sync_targets_.push_back(zone_players_.Find<ZoneLink>(entry.handle)->connection);
+                    }
+                });
             }
-            default:
-                std::cout << "[ZONE-" << zone_id_ << "] Unknown packet type: " << packet.type << " from " << conn->GetAddress() << std::endl;
-                break;
         }
+        RecordStage(STAGE_PUBLISH, stage_start);
+
+        stage_start = std::chrono::steady_clock::now();
+        for (const auto& [connection, result] : move_results_) {
+            network_manager_.SendToClient(connection, Network::EncodePacket(result));
+        }
+        move_results_.clear();
+
+        // 주변 플레이어들에게 위치 동기화 - 틱 전체에서 한 번만 인코딩
+        // 움직인 플레이어 여럿의 시야에 든 플레이어는 여러 번 수집되므로 연결당 한 번만 보낸다
+        if (!sync_targets_.empty()) {
+            std::sort(sync_targets_.begin(), sync_targets_.end());
+            sync_targets_.erase(std::unique(sync_targets_.begin(), sync_targets_.end()), sync_targets_.end());
+            Network::Packet sync_packet = Network::EncodePacket(Network::GameDataMessage{"PLAYER_POSITION_SYNC"});
+            network_manager_.SendToGroup(sync_targets_, sync_packet);
+            sync_targets_.clear();
+        }
+        RecordStage(STAGE_SEND, stage_start);
     }
 
     Network::NetworkManager network_manager_;
+    Network::PacketDispatcher dispatcher_;
     int port_;
+    int max_connections_;
     int zone_id_;
     int map_width_, map_height_;
-    std::vector<std::vector<char>> zone_map_;
-    std::map<uint32_t, ZonePlayer> zone_players_;
+    int view_distance_;
+    float move_speed_;
+    bool collision_enabled_;
+    float body_radius_;
+    std::unique_ptr<Common::SpatialGrid> spatial_grid_;
+    Common::CollisionMap collision_map_;
+    std::unique_ptr<Common::PathService> path_service_;    // 존 락 아래에서만 사용
+    std::chrono::microseconds path_budget_;
+    std::unique_ptr<NpcManager> npc_manager_;              // path_service_보다 먼저 소멸 (대기 요청 취소)
+    ZonePlayerStore zone_players_;
+    std::unordered_map<uint32_t, Common::EntityHandle> player_handles_;  // 연결 ID -> 엔티티
+    std::mutex zone_mutex_;  // 존 플레이어는 여러 I/O 스레드와 존 틱 스레드에서 접근된다
+
+    Common::TickScheduler tick_scheduler_;      // 물리 틱
+    Common::TickScheduler network_scheduler_;   // 위치 전송 틱
+    std::atomic<bool> zone_running_;
+    std::thread zone_thread_;
+    std::thread network_thread_;
+    std::array<StageTiming, STAGE_COUNT> stage_timings_;
+
+    // 존 락 아래 - 마지막 물리 틱 종료 시각과 충돌 단계 결과
+    std::chrono::steady_clock::time_point last_simulated_;
+    Common::SweepAndPrune broadphase_;
+    size_t collision_bodies_ = 0;
+    size_t collision_pairs_ = 0;
+    size_t collision_resolved_ = 0;
+
+    // 스레드별 재사용 목록 - 틱마다 할당하지 않도록 용량을 유지한다
+    std::vector<Common::PathPoint> player_points_;      // 물리 틱
+    std::vector<float> collision_positions_;            // 물리 틱 - 플레이어 뒤에 NPC를 이어 붙인 (x, y) 쌍
+    std::vector<std::pair<std::shared_ptr<Network::Connection>, Network::PlayerMoveResult>> move_results_; // 네트워크 틱
+    std::vector<std::shared_ptr<Network::Connection>> sync_targets_;                                        // 네트워크 틱
 };
 
 int main() {
+    // 설정 로드 (없으면 기본 설정 파일 생성) - 서버 멤버가 생성 시점에 설정을 읽으므로 먼저 한다
+    if (!Common::ZoneServerConfig::LoadConfig()) {
+        std::cerr << "Failed to load zone config, using defaults" << std::endl;
+    }
+
     ZoneServer server;
 
     if (!server.Initialize()) {
@@ -0,0 +1,616 @@
+// zone_server/npc_manager.cpp
+#include "npc_manager.h"
+#include "../common/movement_kernel.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// NPC 데이터 파일용 최소 JSON 읽기 - {"npcs": [{...}, ...]} 형태의 문자열/숫자 필드만 쓴다.
+// 모르는 키와 값(중첩 포함)은 건너뛴다.
+class JsonReader {
+public:
+    explicit JsonReader(const std::string& text) : text_(text), pos_(0) {}
+
+    bool ReadTemplates(std::vector<NpcTemplate>& templates) {
+        if (!Consume('{')) {
+            return false;
+        }
+        if (Consume('}')) {
+            return true;
+        }
+        do {
+            std::string key;
+            if (!ReadString(key) || !Consume(':')) {
+                return false;
+            }
+            if (key == "npcs") {
+                if (!ReadTemplateArray(templates)) {
+                    return false;
+                }
+            } else if (!SkipValue()) {
+                return false;
+            }
+        } while (Consume(','));
+        return Consume('}');
+    }
+
+private:
+    bool ReadTemplateArray(std::vector<NpcTemplate>& templates) {
+        if (!Consume('[')) {
+            return false;
+        }
+        if (Consume(']')) {
+            return true;
+        }
+        do {
+            NpcTemplate npc;
+            if (!ReadTemplate(npc)) {
+                return false;
+            }
+            templates.push_back(npc);
+        } while (Consume(','));
+        return Consume(']');
+    }
+
+    bool ReadTemplate(NpcTemplate& npc) {
+        if (!Consume('{')) {
+            return false;
+        }
+        if (Consume('}')) {
+            return true;
+        }
+        do {
+            std::string key;
+            if (!ReadString(key) || !Consume(':')) {
+                return false;
+            }
+            SkipSpace();
+            if (key == "name") {
+                if (!ReadString(npc.name)) {
+                    return false;
+                }
+                continue;
+            }
+
+            double value;
+            if (pos_ < text_.size() && text_[pos_] != '"' && text_[pos_] != '{' && text_[pos_] != '[') {
+                if (!ReadNumber(value)) {
+                    return false;
+                }
+            } else {
+                if (!SkipValue()) {
+                    return false;
+                }
+                continue;
+            }
+
+            if (key == "id") npc.id = static_cast<uint32_t>(value);
+            else if (key == "count") npc.count = static_cast<int32_t>(value);
+            else if (key == "spawn_batch") npc.spawn_batch = static_cast<int32_t>(value);
+            else if (key == "speed") npc.speed = static_cast<float>(value);
+            else if (key == "wander_radius") npc.wander_radius = static_cast<int32_t>(value);
+            else if (key == "idle_seconds") npc.idle_seconds = static_cast<float>(value);
+            else if (key == "area_x") npc.area_x = static_cast<int32_t>(value);
+            else if (key == "area_y") npc.area_y = static_cast<int32_t>(value);
+            else if (key == "area_width") npc.area_width = static_cast<int32_t>(value);
+            else if (key == "area_height") npc.area_height = static_cast<int32_t>(value);
+        } while (Consume(','));
+        return Consume('}');
+    }
+
+    void SkipSpace() {
+        while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+            ++pos_;
+        }
+    }
+
+    bool Consume(char expected) {
+        SkipSpace();
+        if (pos_ < text_.size() && text_[pos_] == expected) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    bool ReadString(std::string& out) {
+        if (!Consume('"')) {
+            return false;
+        }
+        out.clear();
+        while (pos_ < text_.size()) {
+            char c = text_[pos_++];
+            if (c == '"') {
+                return true;
+            }
+            if (c == '\\' && pos_ < text_.size()) {
+                char escaped = text_[pos_++];
+                out.push_back(escaped == 'n' ? '\n' : escaped == 't' ? '\t' : escaped);
+            } else {
+                out.push_back(c);
+            }
+        }
+        return false;
+    }
+
+    bool ReadNumber(double& value) {
+        SkipSpace();
+        const char* begin = text_.c_str() + pos_;
+        char* end = nullptr;
+        value = std::strtod(begin, &end);
+        if (end == begin) {
+            return false;
+        }
+        pos_ += static_cast<size_t>(end - begin);
+        return true;
+    }
+
+    bool SkipValue() {
+        SkipSpace();
+        if (pos_ >= text_.size()) {
+            return false;
+        }
+        char c = text_[pos_];
+        if (c == '"') {
+            std::string ignored;
+            return ReadString(ignored);
+        }
+        if (c == '{' || c == '[') {
+            char close = c == '{' ? '}' : ']';
+            ++pos_;
+            if (Consume(close)) {
+                return true;
+            }
+            do {
+                if (c == '{') {
+                    std::string key;
+                    if (!ReadString(key) || !Consume(':')) {
+                        return false;
+                    }
+                }
+                if (!SkipValue()) {
+                    return false;
+                }
+            } while (Consume(','));
+            return Consume(close);
+        }
+        for (const char* literal : {"true", "false", "null"}) {
+            size_t length = std::char_traits<char>::length(literal);
+            if (text_.compare(pos_, length, literal) == 0) {
+                pos_ += length;
+                return true;
+            }
+        }
+        double ignored;
+        return ReadNumber(ignored);
+    }
+
+    const std::string& text_;
+    size_t pos_;
+};
+
+// JsonReader::ReadString이 되돌릴 수 있는 이스케이프만 쓴다 (그 밖의 제어 문자는 그대로 둬도 읽힌다)
+std::string EscapeJsonString(const std::string& value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (char c : value) {
+        switch (c) {
+            case '"':  escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\t': escaped += "\\t"; break;
+            default:   escaped.push_back(c); break;
+        }
+    }
+    return escaped;
+}
+
+} // anonymous namespace
+
+std::string NpcManager::Stats::Describe() const {
+    char line[320];
+    std::snprintf(line, sizeof(line),
+                  "npcs=%zu (active=%zu near=%zu dormant=%zu) spawned=%llu thinks=%llu last_thinks=%zu "
+                  "deferred_ticks=%llu path_requests=%llu path_failures=%llu last=%.1fus max=%.1fus",
+                  npcs, by_lod[LOD_ACTIVE], by_lod[LOD_NEAR], by_lod[LOD_DORMANT],
+                  static_cast<unsigned long long>(spawned),
+                  static_cast<unsigned long long>(thinks),
+                  last_thinks,
+                  static_cast<unsigned long long>(deferred_ticks),
+                  static_cast<unsigned long long>(path_requests),
+                  static_cast<unsigned long long>(path_failures),
+                  last_update_us, max_update_us);
+    return line;
+}
+
+NpcManager::NpcManager(const Common::CollisionMap& map, Common::PathService& paths, int max_npcs,
+                       int spawn_interval_seconds, int view_distance, std::chrono::microseconds think_budget)
+    : map_(map)
+    , paths_(paths)
+    , max_npcs_(std::max(0, max_npcs))
+    , spawn_interval_(static_cast<float>(std::max(1, spawn_interval_seconds)))
+    , lod_cell_size_(std::max(1, view_distance))
+    , lod_columns_((map.GetWidth() + lod_cell_size_ - 1) / lod_cell_size_)
+    , lod_rows_((map.GetHeight() + lod_cell_size_ - 1) / lod_cell_size_)
+    , think_budget_(think_budget)
+    , lod_grid_(static_cast<size_t>(std::max(1, lod_columns_ * lod_rows_)), LOD_DORMANT)
+    , random_(std::random_device{}())
+    , tick_(0)
+    , last_dt_(0.0f)
+    , spawn_timer_(spawn_interval_)     // 첫 틱에 바로 스폰
+    , think_cursor_(0)
+    , stats_{} {
+    npcs_.Reserve(static_cast<size_t>(max_npcs_));
+}
+
+NpcManager::~NpcManager() {
+    // 대기 중인 경로 콜백이 this를 잡고 있으므로 취소한다
+    for (const NpcBrain& brain : npcs_.Column<NpcBrain>()) {
+        if (brain.path_request != 0) {
+            paths_.Cancel(brain.path_request);
+        }
+    }
+}
+
+void NpcManager::LoadDefaultTemplates() {
+    templates_.clear();
+
+    NpcTemplate wolf;
+    wolf.id = 1;
+    wolf.name = "wolf";
+    wolf.count = 80;
+    wolf.spawn_batch = 20;
+    wolf.speed = 4.0f;
+    wolf.wander_radius = 15;
+    wolf.idle_seconds = 2.0f;
+    templates_.push_back(wolf);
+
+    NpcTemplate boar;
+    boar.id = 2;
+    boar.name = "boar";
+    boar.count = 70;
+    boar.spawn_batch = 20;
+    boar.speed = 2.5f;
+    boar.wander_radius = 8;
+    boar.idle_seconds = 4.0f;
+    templates_.push_back(boar);
+
+    NpcTemplate villager;
+    villager.id = 3;
+    villager.name = "villager";
+    villager.count = 50;
+    villager.spawn_batch = 10;
+    villager.speed = 1.5f;
+    villager.wander_radius = 5;
+    villager.idle_seconds = 6.0f;
+    templates_.push_back(villager);
+}
+
+bool NpcManager::LoadTemplates(const std::string& filename) {
+    std::ifstream file(filename);
+    if (file.is_open()) {
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        std::string text = buffer.str();
+
+        std::vector<NpcTemplate> templates;
+        JsonReader reader(text);
+        if (reader.ReadTemplates(templates) && !templates.empty()) {
+            templates_ = std::move(templates);
+            alive_by_template_.assign(templates_.size(), 0);
+            return true;
+        }
+        LoadDefaultTemplates();
+        alive_by_template_.assign(templates_.size(), 0);
+        return false;   // 잘못된 파일은 덮어쓰지 않는다
+    }
+
+    LoadDefaultTemplates();
+    alive_by_template_.assign(templates_.size(), 0);
+    return SaveTemplates(filename);
+}
+
+bool NpcManager::SaveTemplates(const std::string& filename) const {
+    // 디렉토리가 없으면 생성
+    std::filesystem::path file_path(filename);
+    auto parent_path = file_path.parent_path();
+    if (!parent_path.empty() && !std::filesystem::exists(parent_path)) {
+        try {
+            std::filesystem::create_directories(parent_path);
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file << "{\n  \"npcs\": [\n";
+    for (size_t i = 0; i < templates_.size(); ++i) {
+        const NpcTemplate& npc = templates_[i];
+        file << "    {\"id\": " << npc.id << ", \"name\": \"" << EscapeJsonString(npc.name) << "\", \"count\": " << npc.count
+             << ", \"spawn_batch\": " << npc.spawn_batch << ", \"speed\": " << npc.speed
+             << ", \"wander_radius\": " << npc.wander_radius << ", \"idle_seconds\": " << npc.idle_seconds
+             << ", \"area_x\": " << npc.area_x << ", \"area_y\": " << npc.area_y
+             << ", \"area_width\": " << npc.area_width << ", \"area_height\": " << npc.area_height << "}"
+             << (i + 1 < templates_.size() ? "," : "") << "\n";
+    }
+    file << "  ]\n}\n";
+    return file.good();
+}
+
+void NpcManager::Update(float dt, const std::vector<Common::PathPoint>& players) {
+    auto start = Clock::now();
+    ++tick_;
+    last_dt_ = dt;
+
+    UpdateSpawns(dt);
+    if (tick_ % kLodRefreshTicks == 1) {
+        RefreshLod(players);
+    }
+    RunThinks(dt);
+
+    // 잠든 NPC는 속도가 0이라 커널을 지나도 제자리
+    if (!npcs_.Empty()) {
+        auto& bodies = npcs_.Column<NpcBody>();
+        const auto& velocities = npcs_.Column<NpcVelocity>();
+        Common::MovementBatch batch{};
+        batch.positions = reinterpret_cast<float*>(bodies.data());
+        batch.velocities = reinterpret_cast<const float*>(velocities.data());
+        batch.count = bodies.size();
+        batch.dt = dt;
+        batch.min_x = 1.0f;
+        batch.min_y = 1.0f;
+        batch.max_x = static_cast<float>(map_.GetWidth() - 2);
+        batch.max_y = static_cast<float>(map_.GetHeight() - 2);
+        batch.collision = &map_;
+        Common::IntegrateMovement(batch);
+    }
+
+    stats_.last_update_us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    stats_.max_update_us = std::max(stats_.max_update_us, stats_.last_update_us);
+}
+
+void NpcManager::UpdateSpawns(float dt) {
+    spawn_timer_ += dt;
+    if (spawn_timer_ < spawn_interval_) {
+        return;
+    }
+    spawn_timer_ = 0.0f;
+
+    for (uint32_t i = 0; i < templates_.size(); ++i) {
+        const NpcTemplate& npc = templates_[i];
+        int32_t missing = npc.count - alive_by_template_[i];
+        int32_t batch = npc.spawn_batch > 0 ? std::min(missing, npc.spawn_batch) : missing;
+        for (int32_t n = 0; n < batch && static_cast<int>(npcs_.Size()) < max_npcs_; ++n) {
+            SpawnNpc(i);
+        }
+    }
+}
+
+bool NpcManager::SpawnNpc(uint32_t template_index) {
+    const NpcTemplate& npc = templates_[template_index];
+    int32_t area_x = npc.area_width > 0 ? npc.area_x : 1;
+    int32_t area_y = npc.area_height > 0 ? npc.area_y : 1;
+    int32_t area_width = npc.area_width > 0 ? npc.area_width : map_.GetWidth() - 2;
+    int32_t area_height = npc.area_height > 0 ? npc.area_height : map_.GetHeight() - 2;
+    if (area_width <= 0 || area_height <= 0) {
+        return false;
+    }
+
+    std::uniform_int_distribution<int32_t> pick_x(area_x, area_x + area_width - 1);
+    std::uniform_int_distribution<int32_t> pick_y(area_y, area_y + area_height - 1);
+    for (int attempt = 0; attempt < 16; ++attempt) {
+        int32_t x = pick_x(random_);
+        int32_t y = pick_y(random_);
+        if (!map_.IsWalkable(x, y)) {
+            continue;
+        }
+
+        Lod lod = static_cast<Lod>(lod_grid_[static_cast<size_t>(std::min(y / lod_cell_size_, lod_rows_ - 1)) * lod_columns_ +
+                                             std::min(x / lod_cell_size_, lod_columns_ - 1)]);
+        uint64_t next_think = lod == LOD_DORMANT ? kNever : tick_ + random_() % ThinkInterval(lod) + 1;
+        npcs_.Create(NpcBody{x + 0.5f, y + 0.5f}, NpcVelocity{0.0f, 0.0f}, NpcSchedule{next_think},
+                     NpcBrain{template_index, STATE_IDLE, lod, x, y, 0, 0}, NpcRoute{});
+        ++alive_by_template_[template_index];
+        ++stats_.spawned;
+        return true;
+    }
+    return false;
+}
+
+uint64_t NpcManager::ThinkInterval(Lod lod) const {
+    return lod == LOD_ACTIVE ? 1 : kNearThinkInterval;
+}
+
+void NpcManager::RefreshLod(const std::vector<Common::PathPoint>& players) {
+    // 플레이어가 있는 셀 주변 3x3은 ACTIVE, 5x5는 NEAR
+    std::fill(lod_grid_.begin(), lod_grid_.end(), LOD_DORMANT);
+    for (const Common::PathPoint& player : players) {
+        int32_t cx = player.x / lod_cell_size_;
+        int32_t cy = player.y / lod_cell_size_;
+        for (int32_t dy = -2; dy <= 2; ++dy) {
+            for (int32_t dx = -2; dx <= 2; ++dx) {
+                int32_t x = cx + dx;
+                int32_t y = cy + dy;
+                if (x < 0 || y < 0 || x >= lod_columns_ || y >= lod_rows_) {
+                    continue;
+                }
+                uint8_t level = (std::abs(dx) <= 1 && std::abs(dy) <= 1) ? LOD_ACTIVE : LOD_NEAR;
+                uint8_t& cell = lod_grid_[static_cast<size_t>(y) * lod_columns_ + x];
+                cell = std::max(cell, level);
+            }
+        }
+    }
+
+    const auto& bodies = npcs_.Column<NpcBody>();
+    auto& velocities = npcs_.Column<NpcVelocity>();
+    auto& schedules = npcs_.Column<NpcSchedule>();
+    auto& brains = npcs_.Column<NpcBrain>();
+    for (size_t i = 0; i < npcs_.Size(); ++i) {
+        int32_t cx = std::min(static_cast<int32_t>(bodies[i].x) / lod_cell_size_, lod_columns_ - 1);
+        int32_t cy = std::min(static_cast<int32_t>(bodies[i].y) / lod_cell_size_, lod_rows_ - 1);
+        Lod lod = static_cast<Lod>(lod_grid_[static_cast<size_t>(cy) * lod_columns_ + cx]);
+        NpcBrain& brain = brains[i];
+        if (lod == brain.lod) {
+            continue;
+        }
+
+        if (lod == LOD_DORMANT) {
+            // 잠들 때는 멈추고 일정에서 뺀다 - 상태와 경로는 그대로 두고 깨어나면 이어간다
+            velocities[i] = NpcVelocity{0.0f, 0.0f};
+            schedules[i].next_think = kNever;
+        } else if (brain.state != STATE_WAITING_PATH) {
+            // 깨어나는 NPC는 한 틱에 몰리지 않도록 주기 안에 흩뿌린다
+            uint64_t interval = ThinkInterval(lod);
+            uint64_t next = tick_ + i % interval;
+            schedules[i].next_think = brain.lod == LOD_DORMANT ? next : std::min(schedules[i].next_think, next);
+        }
+        brain.lod = lod;
+    }
+}
+
+void NpcManager::RunThinks(float dt) {
+    size_t count = npcs_.Size();
+    stats_.last_thinks = 0;
+    if (count == 0) {
+        return;
+    }
+
+    auto deadline = Clock::now() + think_budget_;
+    const auto& schedules = npcs_.Column<NpcSchedule>();
+    size_t index = think_cursor_ % count;
+    for (size_t visited = 0; visited < count; ++visited) {
+        if (schedules[index].next_think <= tick_) {
+            Think(index, dt);
+            ++stats_.last_thinks;
+            if (stats_.last_thinks % kThinksPerClockCheck == 0 && Clock::now() >= deadline) {
+                // 남은 NPC는 일정이 그대로라 다음 틱에 여기서부터 이어서 생각한다
+                think_cursor_ = index + 1;
+                ++stats_.deferred_ticks;
+                break;
+            }
+        }
+        index = index + 1 == count ? 0 : index + 1;
+    }
+    stats_.thinks += stats_.last_thinks;
+}
+
+void NpcManager::Think(size_t dense, float dt) {
+    NpcBrain& brain = npcs_.Column<NpcBrain>()[dense];
+    NpcSchedule& schedule = npcs_.Column<NpcSchedule>()[dense];
+
+    if (brain.state == STATE_IDLE) {
+        StartWander(dense);
+        return;
+    }
+    if (brain.state != STATE_MOVING) {
+        schedule.next_think = kNever;   // 경로 콜백이 깨운다
+        return;
+    }
+
+    NpcBody& body = npcs_.Column<NpcBody>()[dense];
+    NpcVelocity& velocity = npcs_.Column<NpcVelocity>()[dense];
+    const Common::Path& path = *npcs_.Column<NpcRoute>()[dense].path;
+    float speed = templates_[brain.template_index].speed;
+    float step = speed * dt;
+
+    // 한 틱 이동 거리 안이면 도착으로 보고 점에 맞춘 뒤 다음 점으로
+    while (brain.waypoint < path.size()) {
+        float target_x = path[brain.waypoint].x + 0.5f;
+        float target_y = path[brain.waypoint].y + 0.5f;
+        float dx = target_x - body.x;
+        float dy = target_y - body.y;
+        float distance = std::sqrt(dx * dx + dy * dy);
+        if (distance > step) {
+            velocity = NpcVelocity{dx / distance * speed, dy / distance * speed};
+            // 다음 생각은 LOD 주기와 도착 예정 틱 중 빠른 쪽
+            uint64_t ticks_to_arrive = std::max<uint64_t>(1, static_cast<uint64_t>(distance / step));
+            schedule.next_think = tick_ + std::min(ThinkInterval(brain.lod), ticks_to_arrive);
+            return;
+        }
+        body = NpcBody{target_x, target_y};
+        ++brain.waypoint;
+    }
+    Rest(dense);
+}
+
+void NpcManager::StartWander(size_t dense) {
+    NpcBrain& brain = npcs_.Column<NpcBrain>()[dense];
+    const NpcBody& body = npcs_.Column<NpcBody>()[dense];
+    int32_t radius = std::max(1, templates_[brain.template_index].wander_radius);
+    std::uniform_int_distribution<int32_t> offset(-radius, radius);
+
+    for (int attempt = 0; attempt < 4; ++attempt) {
+        Common::PathPoint goal{brain.home_x + offset(random_), brain.home_y + offset(random_)};
+        if (!map_.IsWalkable(goal.x, goal.y)) {
+            continue;
+        }
+
+        Common::PathPoint start{static_cast<int32_t>(body.x), static_cast<int32_t>(body.y)};
+        Common::EntityHandle handle = npcs_.HandleAt(dense);
+        brain.state = STATE_WAITING_PATH;
+        brain.path_request = paths_.Request(start, goal,
+            [this, handle](uint32_t, const Common::PathResult& result) { OnPath(handle, result); });
+        npcs_.Column<NpcSchedule>()[dense].next_think = kNever;
+        ++stats_.path_requests;
+        return;
+    }
+    Rest(dense);
+}
+
+void NpcManager::OnPath(Common::EntityHandle handle, const Common::PathResult& result) {
+    if (!npcs_.IsAlive(handle)) {
+        return;
+    }
+    size_t dense = npcs_.DenseIndex(handle);
+    NpcBrain& brain = npcs_.Column<NpcBrain>()[dense];
+    brain.path_request = 0;
+
+    if (result.status != Common::PathStatus::FOUND || result.path->size() < 2) {
+        if (result.status != Common::PathStatus::FOUND) {
+            ++stats_.path_failures;
+        }
+        Rest(dense);
+        return;
+    }
+
+    npcs_.Column<NpcRoute>()[dense].path = result.path;
+    brain.state = STATE_MOVING;
+    brain.waypoint = 1;
+    npcs_.Column<NpcSchedule>()[dense].next_think = brain.lod == LOD_DORMANT ? kNever : tick_;
+}
+
+void NpcManager::Rest(size_t dense) {
+    NpcBrain& brain = npcs_.Column<NpcBrain>()[dense];
+    brain.state = STATE_IDLE;
+    npcs_.Column<NpcVelocity>()[dense] = NpcVelocity{0.0f, 0.0f};
+    npcs_.Column<NpcRoute>()[dense].path.reset();
+
+    // 쉬는 시간은 틱 길이와 무관하게 초 단위 - 마지막 틱 길이로 환산
+    float idle = templates_[brain.template_index].idle_seconds *
+                 std::uniform_real_distribution<float>(0.5f, 1.5f)(random_);
+    uint64_t idle_ticks = std::max<uint64_t>(1, static_cast<uint64_t>(idle / std::max(last_dt_, 1e-3f)));
+    npcs_.Column<NpcSchedule>()[dense].next_think = brain.lod == LOD_DORMANT ? kNever : tick_ + idle_ticks;
+}
+
+NpcManager::Stats NpcManager::GetStats() const {
+    Stats stats = stats_;
+    stats.npcs = npcs_.Size();
+    stats.by_lod[LOD_DORMANT] = stats.by_lod[LOD_NEAR] = stats.by_lod[LOD_ACTIVE] = 0;
+    for (const NpcBrain& brain : npcs_.Column<NpcBrain>()) {
+        ++stats.by_lod[brain.lod];
+    }
+    return stats;
+}
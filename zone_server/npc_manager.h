@@ -0,0 +1,152 @@
+// zone_server/npc_manager.h
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../common/collision_map.h"
+#include "../common/entity_store.h"
+#include "../common/path_finder.h"
+
+// NPC 종류 - data/npcs.json의 항목 하나
+struct NpcTemplate {
+    uint32_t id = 0;
+    std::string name;
+    int32_t count = 0;              // 동시에 살아 있을 수 있는 수
+    int32_t spawn_batch = 0;        // 스폰 주기마다 새로 만드는 최대 수 (0이면 제한 없음)
+    float speed = 3.0f;             // 초당 타일
+    int32_t wander_radius = 10;     // 스폰 위치(집)에서 배회하는 반경
+    float idle_seconds = 3.0f;      // 목적지에 도착한 뒤 쉬는 시간 (±50% 무작위)
+    int32_t area_x = 0;             // 스폰 영역 - 크기가 0이면 맵 전체
+    int32_t area_y = 0;
+    int32_t area_width = 0;
+    int32_t area_height = 0;
+};
+
+// 존 NPC 시뮬레이션
+// NPC는 SoA 엔티티 저장소에 두고, 이동은 플레이어와 같은 일괄 이동 커널로 적분한다.
+// AI는 상세도(LOD)에 따라 주기가 다르다 - 근처에 플레이어가 있으면 매 틱, 조금 떨어져 있으면
+// kNearThinkInterval 틱마다, 아무도 없으면 잠든다(생각도 이동도 하지 않음). LOD는 시야 거리 크기의
+// 거친 격자에 플레이어 위치를 찍어 NPC마다 한 번의 조회로 정한다.
+// 한 틱의 AI 작업은 think_budget 안에서만 하고, 못 한 NPC는 다음 틱에 이어서 한다.
+// 스레드 안전하지 않다 - 존 틱에서 존 락 아래에서만 사용한다.
+class NpcManager {
+public:
+    enum Lod : uint8_t {
+        LOD_DORMANT,
+        LOD_NEAR,
+        LOD_ACTIVE
+    };
+
+    struct Stats {
+        size_t npcs;
+        size_t by_lod[3];
+        uint64_t spawned;
+        uint64_t thinks;            // 누적
+        uint64_t deferred_ticks;    // 예산 초과로 생각을 다음 틱으로 미룬 틱 수
+        uint64_t path_requests;
+        uint64_t path_failures;
+        size_t last_thinks;         // 마지막 틱
+        double last_update_us;
+        double max_update_us;
+
+        std::string Describe() const;
+    };
+
+    NpcManager(const Common::CollisionMap& map, Common::PathService& paths, int max_npcs,
+               int spawn_interval_seconds, int view_distance, std::chrono::microseconds think_budget);
+    ~NpcManager();
+
+    // 파일이 없으면 기본 템플릿을 쓰고 그 파일을 만든다
+    bool LoadTemplates(const std::string& filename);
+    const std::vector<NpcTemplate>& GetTemplates() const { return templates_; }
+
+    // 존 틱마다 호출 - players는 이번 틱의 플레이어 격자 위치
+    void Update(float dt, const std::vector<Common::PathPoint>& players);
+
+    Stats GetStats() const;
+
+    // 존 충돌 단계가 NPC를 직접 밀어낼 수 있도록 위치 열을 (x, y) float 쌍 배열로 노출
+    size_t GetCount() const { return npcs_.Size(); }
+    float* GetPositions() { return reinterpret_cast<float*>(npcs_.Column<NpcBody>().data()); }
+
+private:
+    static constexpr uint64_t kNever = UINT64_MAX;
+    static constexpr uint64_t kNearThinkInterval = 8;
+    static constexpr uint64_t kLodRefreshTicks = 15;
+    static constexpr size_t kThinksPerClockCheck = 32;
+
+    enum State : uint8_t {
+        STATE_IDLE,
+        STATE_WAITING_PATH,
+        STATE_MOVING
+    };
+
+    // 컴포넌트 - 이동 커널이 읽는 (x, y) 쌍과 틱마다 훑는 일정은 작게, AI 상태는 따로
+    struct NpcBody {
+        float x, y;
+    };
+
+    struct NpcVelocity {
+        float x, y;
+    };
+
+    struct NpcSchedule {
+        uint64_t next_think;    // 이 틱 이후에 생각 (kNever면 잠듦)
+    };
+
+    struct NpcBrain {
+        uint32_t template_index;
+        State state;
+        Lod lod;
+        int32_t home_x, home_y;
+        uint32_t path_request;  // 대기 중인 경로 요청 (0이면 없음)
+        uint32_t waypoint;      // 이동 중인 경로의 다음 점 인덱스
+    };
+
+    struct NpcRoute {
+        std::shared_ptr<const Common::Path> path;
+    };
+
+    static_assert(sizeof(NpcBody) == 2 * sizeof(float), "NpcBody must be a packed float pair");
+    static_assert(sizeof(NpcVelocity) == 2 * sizeof(float), "NpcVelocity must be a packed float pair");
+
+    using NpcStore = Common::EntityStore<NpcBody, NpcVelocity, NpcSchedule, NpcBrain, NpcRoute>;
+
+    void LoadDefaultTemplates();
+    bool SaveTemplates(const std::string& filename) const;
+
+    void UpdateSpawns(float dt);
+    bool SpawnNpc(uint32_t template_index);
+    void RefreshLod(const std::vector<Common::PathPoint>& players);
+    void RunThinks(float dt);
+    void Think(size_t dense, float dt);
+    void StartWander(size_t dense);
+    void OnPath(Common::EntityHandle handle, const Common::PathResult& result);
+    void Rest(size_t dense);
+    uint64_t ThinkInterval(Lod lod) const;
+
+    const Common::CollisionMap& map_;
+    Common::PathService& paths_;
+    int max_npcs_;
+    float spawn_interval_;
+    int32_t lod_cell_size_;
+    int32_t lod_columns_;
+    int32_t lod_rows_;
+    std::chrono::microseconds think_budget_;
+
+    std::vector<NpcTemplate> templates_;
+    std::vector<int32_t> alive_by_template_;   // NPC를 없애는 경로가 생기면 거기서 줄여야 한다 (지금은 소멸 없음)
+    NpcStore npcs_;
+    std::vector<uint8_t> lod_grid_;    // 거친 격자 셀별 Lod
+    std::mt19937 random_;
+
+    uint64_t tick_;
+    float last_dt_;         // 쉬는 시간(초)을 틱 수로 바꿀 때 쓰는 마지막 틱 길이
+    float spawn_timer_;
+    size_t think_cursor_;   // 예산 초과 시 다음 틱에 이어서 볼 밀집 인덱스
+    Stats stats_;
+};